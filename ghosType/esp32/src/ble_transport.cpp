@@ -0,0 +1,347 @@
+/**
+ * @file ble_transport.cpp
+ * @brief BLE GATT 수신 경로 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "ble_transport.h"
+#include "boot_profile.h"
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#include <esp_gap_ble_api.h>
+#include <esp_gatts_api.h>
+
+// BLE UUID (Nordic UART 서비스)
+#define SERVICE_UUID        "6e400001-b5a3-f393-e0a9-e50e24dcca9e"
+#define RX_CHAR_UUID        "6e400002-b5a3-f393-e0a9-e50e24dcca9e"
+#define TX_CHAR_UUID        "6e400003-b5a3-f393-e0a9-e50e24dcca9e"
+
+// GAP 이벤트를 받을 서버 (GAP 핸들러는 전역 함수 하나)
+static BleTransport* gapOwner = NULL;
+
+BleLinkStack::BleLinkStack() : length_pending(false) {
+    memset(peer, 0, sizeof(peer));
+}
+
+void BleLinkStack::setPeer(const uint8_t address[6]) {
+    memcpy(peer, address, sizeof(peer));
+    length_pending = false;
+}
+
+bool BleLinkStack::takeDataLengthPending() {
+    bool pending = length_pending;
+    length_pending = false;
+    return pending;
+}
+
+bool BleLinkStack::requestConnParams(uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout) {
+    esp_ble_conn_update_params_t params = {};
+    memcpy(params.bda, peer, sizeof(peer));
+    params.min_int = min_interval;
+    params.max_int = max_interval;
+    params.latency = latency;
+    params.timeout = timeout;
+    return esp_ble_gap_update_conn_params(&params) == ESP_OK;
+}
+
+bool BleLinkStack::requestDataLength(uint16_t tx_octets) {
+    length_pending = esp_ble_gap_set_pkt_data_len(peer, tx_octets) == ESP_OK;
+    return length_pending;
+}
+
+bool BleLinkStack::requestPhy2M() {
+    return esp_ble_gap_set_preferred_phy(peer, 0, ESP_BLE_GAP_PHY_2M_PREF_MASK, ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                         ESP_BLE_GAP_PHY_OPTIONS_NO_PREF) == ESP_OK;
+}
+
+// BLE 서버 콜백 - conn_id로 링크 배정/해제, BLE 태스크에 광고 재시작 요청
+// (스택 콜백 안에서 기다리거나 광고를 다시 설정하지 않음)
+class BleServerCallbacks : public BLEServerCallbacks {
+public:
+    explicit BleServerCallbacks(BleTransport& owner) : transport(owner) {}
+
+    void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+        transport.advertising = false;  // 연결되면 스택이 광고를 멈춤
+        BleLink* link = transport.claimLink(param->connect.remote_bda);
+        if (!link) {
+            pServer->disconnect(param->connect.conn_id);  // 광고를 멈추기 전에 들어온 연결
+            return;
+        }
+        link->conn_id = param->connect.conn_id;
+        link->link_stack.setPeer(param->connect.remote_bda);
+        link->is_connected = true;
+        link->link_manager.connected(millis());
+        link->connectionChanged(true);
+        if (transport.task) {
+            xTaskNotifyGive(transport.task);
+        }
+    }
+
+    void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+        BleLink* link = transport.linkForConn(param->mtu.conn_id);
+        if (link) {
+            link->link_manager.mtuUpdated(param->mtu.mtu);
+        }
+    }
+
+    void onDisconnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+        BleLink* link = transport.linkForConn(param->disconnect.conn_id);
+        if (link) {
+            link->is_connected = false;
+            link->released_at = millis();
+            link->link_manager.disconnected();
+            link->connectionChanged(false);
+        }
+        transport.link_dropped = true;
+        if (transport.task) {
+            xTaskNotifyGive(transport.task);
+        }
+    }
+
+private:
+    BleTransport& transport;
+};
+
+// RX 특성 쓰기 콜백 - 쓰기 하나가 메시지 하나, 쓴 연결의 링크로 전달
+class BleRxCallbacks : public BLECharacteristicCallbacks {
+public:
+    explicit BleRxCallbacks(BleTransport& owner) : transport(owner) {}
+
+    void onWrite(BLECharacteristic* pCharacteristic, esp_ble_gatts_cb_param_t* param) {
+        BleLink* link = transport.linkForConn(param->write.conn_id);
+        std::string rxValue = pCharacteristic->getValue();
+        if (link && rxValue.length() > 0) {
+            link->link_manager.received((const uint8_t*)rxValue.data(), rxValue.length(), millis());
+            link->deliver((const uint8_t*)rxValue.data(), rxValue.length());
+        }
+    }
+
+private:
+    BleTransport& transport;
+};
+
+BleLink::BleLink()
+    : owner(NULL), conn_id(0), is_connected(false), released_at(0), link_manager(link_stack) {
+    strcpy(link_name, "ble");
+}
+
+bool BleLink::begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) {
+    receive_handler = on_receive;
+    connection_handler = on_connection;
+    link_manager.initialize();
+    return owner->start();
+}
+
+void BleLink::notify(const String& message) {
+    if (is_connected) {
+        owner->notify(conn_id, message);
+    }
+}
+
+BleTransport::BleTransport()
+    : server(NULL), tx_characteristic(NULL), task(NULL), advertising(false), link_dropped(false),
+      fast_advertising(false), advertising_since(0) {
+    for (size_t i = 0; i < BLE_MAX_CENTRALS; i++) {
+        links[i].owner = this;
+        if (i > 0) {
+            snprintf(links[i].link_name, sizeof(links[i].link_name), "ble%u", (unsigned)(i + 1));
+        }
+    }
+}
+
+bool BleTransport::start() {
+    if (task) {
+        return true;
+    }
+    // BLE를 별도 태스크로 실행
+    return xTaskCreatePinnedToCore(
+        bleTask,          // 태스크 함수
+        "BLE_Task",       // 태스크 이름
+        8192,             // 스택 크기
+        this,             // 파라미터
+        1,                // 우선순위
+        &task,            // 태스크 핸들 (연결/해제 시 광고 재시작 알림)
+        0                 // CPU 코어 (0번 코어)
+    ) == pdPASS;
+}
+
+BleLink* BleTransport::claimLink(const uint8_t address[6]) {
+    BleLink* oldest = NULL;
+    for (BleLink& link : links) {
+        if (link.is_connected) {
+            continue;
+        }
+        if (link.released_at != 0 && link.link_stack.isPeer(address)) {
+            return &link;  // 같은 중앙 장치의 재연결 - 세션 재개가 같은 클라이언트에서 이루어짐
+        }
+        if (!oldest || link.released_at < oldest->released_at) {
+            oldest = &link;
+        }
+    }
+    return oldest;
+}
+
+BleLink* BleTransport::linkForConn(uint16_t conn_id) {
+    for (BleLink& link : links) {
+        if (link.is_connected && link.conn_id == conn_id) {
+            return &link;
+        }
+    }
+    return NULL;
+}
+
+BleLink* BleTransport::linkForPeer(const uint8_t address[6]) {
+    for (BleLink& link : links) {
+        if (link.is_connected && link.link_stack.isPeer(address)) {
+            return &link;
+        }
+    }
+    return NULL;
+}
+
+void BleTransport::startAdvertising(bool fast) {
+    BLEAdvertising* advertising_handle = BLEDevice::getAdvertising();
+    advertising_handle->stop();
+    advertising_handle->setMinInterval(fast ? BLE_ADV_FAST_MIN : BLE_ADV_SLOW_MIN);
+    advertising_handle->setMaxInterval(fast ? BLE_ADV_FAST_MAX : BLE_ADV_SLOW_MAX);
+    advertising_handle->start();
+    advertising = true;
+    fast_advertising = fast;
+    advertising_since = millis();
+}
+
+void BleTransport::onGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    if (!gapOwner) {
+        return;
+    }
+    BleLink* link = NULL;
+    switch (event) {
+        case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+            // 요청 결과뿐 아니라 중앙 장치가 스스로 바꾼 경우에도 옴
+            link = gapOwner->linkForPeer(param->update_conn_params.bda);
+            if (link) {
+                link->link_manager.paramsUpdated(param->update_conn_params.status == ESP_BT_STATUS_SUCCESS,
+                                                 param->update_conn_params.conn_int, param->update_conn_params.latency,
+                                                 param->update_conn_params.timeout);
+            }
+            break;
+        case ESP_GAP_BLE_SET_PKT_LENGTH_COMPLETE_EVT:
+            for (BleLink& candidate : gapOwner->links) {
+                if (candidate.is_connected && candidate.link_stack.takeDataLengthPending()) {
+                    candidate.link_manager.dataLengthUpdated(param->pkt_data_lenth_cmpl.status == ESP_BT_STATUS_SUCCESS,
+                                                             param->pkt_data_lenth_cmpl.params.tx_len,
+                                                             param->pkt_data_lenth_cmpl.params.rx_len);
+                    break;
+                }
+            }
+            break;
+        case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+            link = gapOwner->linkForPeer(param->phy_update.bda);
+            if (link) {
+                link->link_manager.phyUpdated(param->phy_update.status == ESP_BT_STATUS_SUCCESS,
+                                              param->phy_update.tx_phy == ESP_BLE_GAP_PHY_2M,
+                                              param->phy_update.rx_phy == ESP_BLE_GAP_PHY_2M);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void BleTransport::notify(uint16_t conn_id, const String& message) {
+    if (!server || !tx_characteristic) {
+        return;
+    }
+    // BLECharacteristic::notify()는 연결된 모든 중앙 장치에 보내므로 연결 번호를 지정해 직접 보냄
+    esp_ble_gatts_send_indicate(server->getGattsIf(), conn_id, tx_characteristic->getHandle(),
+                                message.length(), (uint8_t*)message.c_str(), false);
+}
+
+// BLE 초기화 태스크
+void BleTransport::bleTask(void* parameter) {
+    BleTransport* self = (BleTransport*)parameter;
+
+    // BLE 초기화 - JavaScript와 일치
+    BLEDevice::init("GHOSTYPE");
+    
+    // MTU 크기 설정 (안정성을 위해 적절한 크기로 조정)
+    BLEDevice::setMTU(BLE_MTU); // 안정성과 호환성을 위해 247로 설정
+    BootProfile::mark(BOOT_PHASE_BLE_STACK);
+    gapOwner = self;
+    BLEDevice::setCustomGapHandler(onGapEvent);
+    
+    // 보안 비활성화
+    esp_ble_auth_req_t auth_req = ESP_LE_AUTH_NO_BOND;
+    esp_ble_io_cap_t iocap = ESP_IO_CAP_NONE;
+    uint8_t key_size = 16;
+    uint8_t init_key = ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK;
+    uint8_t rsp_key = ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK;
+    esp_ble_gap_set_security_param(ESP_BLE_SM_AUTHEN_REQ_MODE, &auth_req, sizeof(uint8_t));
+    esp_ble_gap_set_security_param(ESP_BLE_SM_IOCAP_MODE, &iocap, sizeof(uint8_t));
+    esp_ble_gap_set_security_param(ESP_BLE_SM_MAX_KEY_SIZE, &key_size, sizeof(uint8_t));
+    esp_ble_gap_set_security_param(ESP_BLE_SM_SET_INIT_KEY, &init_key, sizeof(uint8_t));
+    esp_ble_gap_set_security_param(ESP_BLE_SM_SET_RSP_KEY, &rsp_key, sizeof(uint8_t));
+    
+    // 서버 생성
+    self->server = BLEDevice::createServer();
+    self->server->setCallbacks(new BleServerCallbacks(*self));
+    
+    // 서비스 생성
+    BLEService *pService = self->server->createService(SERVICE_UUID);
+    
+    // RX 특성 - 응답 없는 쓰기도 받음 (연결 이벤트 하나에 여러 패킷, 손실은 순번 프레임으로 감지)
+    BLECharacteristic* rx = pService->createCharacteristic(
+        RX_CHAR_UUID,
+        BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_WRITE_NR
+    );
+    rx->setCallbacks(new BleRxCallbacks(*self));
+    
+    // TX 특성
+    BLECharacteristic* tx = pService->createCharacteristic(
+        TX_CHAR_UUID,
+        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
+    );
+    tx->addDescriptor(new BLE2902());
+    self->tx_characteristic = tx;
+    
+    // 서비스 시작 (TX 특성 핸들이 정해진 뒤에 알림 허용)
+    pService->start();
+    
+    // 광고 시작
+    BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
+    pAdvertising->addServiceUUID(SERVICE_UUID);
+    pAdvertising->setScanResponse(true);
+    pAdvertising->setMinPreferred(BLE_MIN_CONN_INTERVAL);
+    pAdvertising->setMaxPreferred(BLE_MAX_CONN_INTERVAL);
+    self->startAdvertising(true);
+    BootProfile::mark(BOOT_PHASE_ADVERTISING);
+    
+    // 스택은 자체 태스크에서 동작 - 이 태스크는 광고 재시작과 간격 전환, 링크 관리 주기 확인만 맡음
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LINK_TICK_MS));
+        size_t connected = 0;
+        for (BleLink& link : self->links) {
+            if (link.is_connected) {
+                link.link_manager.tick(millis());
+                connected++;
+            }
+        }
+        if (connected >= BLE_MAX_CENTRALS) {
+            continue;  // 링크가 모두 참 - 연결되면서 스택이 광고를 멈춘 상태 유지
+        }
+        if (self->link_dropped) {
+            // 연결 해제 - 곧바로 빠른 간격으로 광고해 같은 클라이언트가 빨리 다시 찾도록
+            self->link_dropped = false;
+            self->startAdvertising(true);
+        } else if (!self->advertising) {
+            // 새 연결로 광고가 멈춤 - 빈 링크가 남았으면 다른 중앙 장치를 위해 계속 광고
+            // (연결된 중앙 장치가 있으면 전송을 덜 방해하도록 느린 간격)
+            self->startAdvertising(connected == 0);
+        } else if (self->fast_advertising && millis() - self->advertising_since > BLE_ADV_FAST_WINDOW_MS) {
+            self->startAdvertising(false);
+        }
+    }
+}
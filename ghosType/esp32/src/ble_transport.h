@@ -0,0 +1,166 @@
+/**
+ * @file ble_transport.h
+ * @brief BLE GATT 수신 경로 (Nordic UART 호환 서비스)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * RX 특성에 쓴 값 하나가 메시지 하나이고, 응답은 TX 특성 알림으로 보냅니다.
+ * RX 특성은 응답 없는 쓰기도 받으며, 대량 전송은 순번 프레임(frame_sequencer.h)으로 감싸 손실을 찾습니다.
+ * BLE 스택 초기화와 광고는 코어 0의 BLE 태스크에서 실행합니다.
+ *
+ * 중앙 장치는 BLE_MAX_CENTRALS개까지 동시에 연결합니다. GATT 서버는 하나이고 연결마다
+ * 링크(BleLink) 하나가 conn_id로 묶이며, 수신 처리에는 링크 하나가 경로(클라이언트) 하나로 보이므로
+ * 속도, 배열, 청크 조립, 세션과 응답 대상이 연결마다 따로입니다. 응답은 그 연결에만 알림으로 보냅니다.
+ *
+ * 연결되면 스택이 광고를 멈추므로 빈 링크가 남아 있는 동안 BLE 태스크가 느린 간격(BLE_ADV_SLOW_*)으로
+ * 다시 광고합니다 (연결된 중앙 장치의 전송 방해 최소화). 연결이 끊기면 스택 콜백은 BLE 태스크를 깨우기만 하고,
+ * BLE 태스크가 곧바로 빠른 간격(BLE_ADV_FAST_*)으로 광고한 뒤 BLE_ADV_FAST_WINDOW_MS가 지나면
+ * 느린 간격으로 바꿉니다. 부팅 직후 광고도 같은 방식이며, 링크가 모두 차면 광고하지 않습니다.
+ *
+ * 연결 중에는 링크마다 링크 관리(link_manager.h)가 수신 트래픽에 따라 연결 간격, 데이터 길이,
+ * PHY를 요청합니다. 요청은 ESP GAP API로 보내고, 결과는 GAP 이벤트로 돌려받아 상대 주소로 링크를 찾습니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <esp_gap_ble_api.h>
+#include "config.h"
+#include "transport.h"
+#include "link_manager.h"
+
+class BLEServer;
+class BLECharacteristic;
+class BleTransport;
+
+/**
+ * @brief ESP GAP API로 링크 제어를 요청하는 스택 (연결된 상대 주소 기준)
+ */
+class BleLinkStack : public ILinkStack {
+public:
+    BleLinkStack();
+
+    /**
+     * @brief 연결된 상대 주소 기록 (연결 콜백에서)
+     */
+    void setPeer(const uint8_t address[6]);
+
+    /**
+     * @brief 상대 주소가 같은지 확인 (GAP 이벤트와 재연결한 중앙 장치의 링크 찾기)
+     */
+    bool isPeer(const uint8_t address[6]) const { return memcmp(peer, address, sizeof(peer)) == 0; }
+
+    /**
+     * @brief 데이터 길이 요청 결과를 기다리는지 확인하고 지움
+     *
+     * 데이터 길이 결과 이벤트에는 상대 주소가 없으므로 결과를 기다리는 링크로 보냅니다.
+     */
+    bool takeDataLengthPending();
+
+    bool requestConnParams(uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout) override;
+    bool requestDataLength(uint16_t tx_octets) override;
+    bool requestPhy2M() override;
+
+private:
+    uint8_t peer[6];
+    volatile bool length_pending;
+};
+
+/**
+ * @brief BLE 연결 하나의 수신 경로 (중앙 장치 하나 = 클라이언트 하나)
+ *
+ * 수신은 BLE 스택의 쓰기 콜백에서, notify()는 어느 태스크에서나 호출합니다.
+ */
+class BleLink : public ITransport {
+public:
+    BleLink();
+
+    const char* name() const override { return link_name; }
+
+    /**
+     * @brief 처리 함수 등록과 BLE 태스크 시작 (링크마다 불려도 태스크는 하나)
+     */
+    bool begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) override;
+
+    /**
+     * @brief 이 연결에만 TX 특성 알림 전송
+     */
+    void notify(const String& message) override;
+
+    bool connected() const override { return is_connected; }
+
+    size_t mtu() const override { return BLE_MTU - BLE_ATT_HEADER; }
+
+    const LinkManager* link() const override { return &link_manager; }
+
+private:
+    friend class BleTransport;
+    friend class BleServerCallbacks;
+    friend class BleRxCallbacks;
+
+    BleTransport* owner;
+    char link_name[8];            ///< "ble", "ble2", ...
+    volatile uint16_t conn_id;    ///< 연결 중인 BLE 연결 번호
+    volatile bool is_connected;
+    uint32_t released_at;         ///< 마지막으로 끊긴 시각 (0: 연결된 적 없음)
+    BleLinkStack link_stack;
+    LinkManager link_manager;
+};
+
+/**
+ * @brief BLE GATT 서버 - 링크 BLE_MAX_CENTRALS개가 서버와 BLE 태스크를 공유
+ */
+class BleTransport {
+public:
+    BleTransport();
+
+    /**
+     * @brief 링크 (transports 배열에 링크마다 하나씩 넣음)
+     */
+    BleLink& link(size_t index) { return links[index]; }
+
+    /**
+     * @brief BLE 태스크 생성 (스택 초기화, 서비스 등록, 광고 시작) - 처음 한 번만
+     */
+    bool start();
+
+    /**
+     * @brief 한 연결에만 TX 특성 알림 전송 (어느 태스크에서나)
+     */
+    void notify(uint16_t conn_id, const String& message);
+
+private:
+    friend class BleServerCallbacks;
+    friend class BleRxCallbacks;
+
+    static void bleTask(void* parameter);
+
+    /**
+     * @brief 링크 제어 요청 결과 GAP 이벤트 → 상대 주소가 같은 링크의 링크 관리 (BLE 스택 태스크)
+     */
+    static void onGapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+
+    /**
+     * @brief 새 연결에 줄 링크 - 같은 주소가 쓰던 링크(세션/조립 상태가 남아 있음), 없으면 가장 오래 비어 있던 링크
+     * @return NULL 빈 링크 없음
+     */
+    BleLink* claimLink(const uint8_t address[6]);
+
+    BleLink* linkForConn(uint16_t conn_id);
+    BleLink* linkForPeer(const uint8_t address[6]);
+
+    /**
+     * @brief 광고 (재)시작 (BLE 태스크에서만 호출)
+     * @param fast true이면 BLE_ADV_FAST_* 간격, false이면 BLE_ADV_SLOW_* 간격
+     */
+    void startAdvertising(bool fast);
+
+    BLEServer* server;
+    BLECharacteristic* tx_characteristic;
+    TaskHandle_t task;            ///< BLE 태스크 (연결/해제 알림 대상)
+    volatile bool advertising;    ///< 광고 중 (연결되면 스택이 멈추므로 연결 콜백에서 지움)
+    volatile bool link_dropped;   ///< 연결이 끊겨 빠른 간격으로 다시 광고해야 함
+    bool fast_advertising;        ///< 빠른 간격으로 광고 중
+    uint32_t advertising_since;   ///< 현재 광고를 시작한 시각
+    BleLink links[BLE_MAX_CENTRALS];
+};
@@ -0,0 +1,58 @@
+/**
+ * @file boot_profile.cpp
+ * @brief 부팅 단계별 시각 기록 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "boot_profile.h"
+#include <esp_timer.h>
+
+// BootPhase 순서의 단계 이름 (상태 보고용)
+static const char* const PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    "setup", "lanes", "transports", "hid", "storage", "ready",
+    "ble_stack", "advertising", "usb_mounted", "connected", "first_job"
+};
+
+volatile int64_t BootProfile::phase_us[BOOT_PHASE_COUNT] = {};
+
+// 리셋 원인 이름 - 전원 투입과 소프트웨어 리셋(resetSystem), 워치독/패닉을 구분
+static const char* resetReasonName(esp_reset_reason_t reason) {
+    switch (reason) {
+        case ESP_RST_POWERON:   return "poweron";
+        case ESP_RST_EXT:       return "external";
+        case ESP_RST_SW:        return "software";
+        case ESP_RST_PANIC:     return "panic";
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:       return "watchdog";
+        case ESP_RST_DEEPSLEEP: return "deepsleep";
+        case ESP_RST_BROWNOUT:  return "brownout";
+        default:                return "unknown";
+    }
+}
+
+void BootProfile::mark(BootPhase phase) {
+    if (phase_us[phase] == 0) {
+        int64_t now = esp_timer_get_time();
+        phase_us[phase] = now > 0 ? now : 1;
+    }
+}
+
+String BootProfile::statsJson() {
+    String json = "{\"reset\":\"";
+    json += resetReasonName(esp_reset_reason());
+    json += "\"";
+    for (size_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        int64_t at = phase_us[i];
+        if (at == 0) {
+            continue;
+        }
+        json += ",\"";
+        json += PHASE_NAMES[i];
+        json += "\":";
+        json += (unsigned long)at;
+    }
+    json += "}";
+    return json;
+}
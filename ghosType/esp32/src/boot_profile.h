@@ -0,0 +1,59 @@
+/**
+ * @file boot_profile.h
+ * @brief 부팅 단계별 시각 기록 (리셋부터 광고 시작, USB 열거, 첫 연결까지)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 전원을 넣거나 리셋한 뒤 동글이 언제부터 쓸 수 있는지 보려고 단계마다
+ * esp_timer_get_time()(리셋 후 앱 시작 시점부터 센 마이크로초) 값을 한 번씩 남깁니다.
+ * 단계는 setup()뿐 아니라 BLE 태스크, USB 이벤트 태스크, 수신 경로에서도 찍히므로
+ * 인스턴스 없이 정적 함수로 부르고, 단계마다 처음 한 번만 기록합니다.
+ * 상태 보고(GHTYPE_STS)의 "boot" 항목으로 BLE/CDC 어느 경로로든 읽을 수 있습니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * @brief 부팅 단계 (JSON 이름은 boot_profile.cpp의 PHASE_NAMES)
+ */
+enum BootPhase : uint8_t {
+    BOOT_PHASE_SETUP = 0,      ///< setup() 진입
+    BOOT_PHASE_LANES,          ///< 레인/미러/스트림 준비 - 수신 콜백을 받아도 됨
+    BOOT_PHASE_TRANSPORTS,     ///< 모든 수신 경로 begin() 반환 (BLE 스택은 코어 0에서 계속 초기화)
+    BOOT_PHASE_HID,            ///< USB HID 키보드 시작
+    BOOT_PHASE_STORAGE,        ///< 스니펫 저장소(NVS) 열림
+    BOOT_PHASE_READY,          ///< 컴파일 태스크 시작, setup() 끝
+    BOOT_PHASE_BLE_STACK,      ///< BLEDevice::init() 완료
+    BOOT_PHASE_ADVERTISING,    ///< BLE 광고 시작
+    BOOT_PHASE_USB_MOUNTED,    ///< 호스트가 USB 장치를 열거함 (ARDUINO_USB_STARTED_EVENT)
+    BOOT_PHASE_CONNECTED,      ///< 첫 클라이언트 연결 (경로 무관)
+    BOOT_PHASE_FIRST_JOB,      ///< 첫 작업 타이핑 시작
+    BOOT_PHASE_COUNT
+};
+
+/**
+ * @brief 부팅 단계 기록 클래스
+ */
+class BootProfile {
+public:
+    /**
+     * @brief 단계 도달 기록 (이미 기록된 단계는 무시, 어느 태스크에서나 호출 가능)
+     */
+    static void mark(BootPhase phase);
+
+    /**
+     * @brief 단계에 도달했는지
+     */
+    static bool reached(BootPhase phase) { return phase_us[phase] != 0; }
+
+    /**
+     * @brief 부팅 보고를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"reset":"poweron","setup":us,"lanes":us,...} - 아직 도달하지 않은 단계는 빠짐
+     */
+    static String statsJson();
+
+private:
+    static volatile int64_t phase_us[BOOT_PHASE_COUNT];
+};
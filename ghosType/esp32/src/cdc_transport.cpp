@@ -0,0 +1,114 @@
+/**
+ * @file cdc_transport.cpp
+ * @brief USB CDC 시리얼 수신 경로 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "cdc_transport.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+CdcTransport::CdcTransport() : state(FRAME_WAIT_SYNC), expected(0), was_connected(false) {
+}
+
+bool CdcTransport::begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) {
+    receive_handler = on_receive;
+    connection_handler = on_connection;
+    Serial.setRxBufferSize(CDC_RX_BUFFER_SIZE);
+    // 호스트가 포트를 읽지 않을 때 응답 전송이 타이핑을 막지 않도록
+    Serial.setTxTimeoutMs(0);
+    Serial.begin(115200);  // USB CDC는 보율과 무관하게 USB 속도로 동작
+    payload.reserve(MAX_MESSAGE_BYTES);
+
+    // 수신 태스크 (코어 0)
+    return xTaskCreatePinnedToCore(
+        receiveTask,      // 태스크 함수
+        "CDC_Task",       // 태스크 이름
+        CDC_TASK_STACK,   // 스택 크기
+        this,             // 파라미터
+        1,                // 우선순위
+        NULL,             // 태스크 핸들
+        0                 // CPU 코어 (0번 코어)
+    ) == pdPASS;
+}
+
+void CdcTransport::receiveTask(void* parameter) {
+    CdcTransport* self = (CdcTransport*)parameter;
+    while (true) {
+        bool now_connected = self->connected();
+        if (now_connected != self->was_connected) {
+            self->was_connected = now_connected;
+            self->connectionChanged(now_connected);
+        }
+        if (self->poll() == 0) {
+            vTaskDelay(pdMS_TO_TICKS(CDC_IDLE_WAIT_MS));
+        }
+    }
+}
+
+size_t CdcTransport::poll() {
+    uint8_t buffer[CDC_READ_CHUNK];
+    int available = Serial.available();
+    if (available <= 0) {
+        return 0;
+    }
+    size_t length = Serial.readBytes(buffer, MIN((size_t)available, sizeof(buffer)));
+
+    size_t i = 0;
+    while (i < length) {
+        switch (state) {
+            case FRAME_WAIT_SYNC:
+                if (buffer[i] == CDC_FRAME_SYNC) {
+                    state = FRAME_LENGTH_LOW;
+                } else {
+                    rx_counter.reject();  // 프레임 밖의 바이트
+                }
+                i++;
+                break;
+            case FRAME_LENGTH_LOW:
+                expected = buffer[i++];
+                state = FRAME_LENGTH_HIGH;
+                break;
+            case FRAME_LENGTH_HIGH:
+                expected |= (size_t)buffer[i++] << 8;
+                if (expected == 0 || expected > MAX_MESSAGE_BYTES) {
+                    rx_counter.reject();
+                    state = FRAME_WAIT_SYNC;  // 다음 동기 바이트에서 다시 맞춤
+                } else {
+                    payload.clear();
+                    state = FRAME_PAYLOAD;
+                }
+                break;
+            case FRAME_PAYLOAD: {
+                // 메시지 본문은 한 번에 복사
+                size_t take = MIN(expected - payload.size(), length - i);
+                payload.insert(payload.end(), buffer + i, buffer + i + take);
+                i += take;
+                if (payload.size() == expected) {
+                    deliver(payload.data(), payload.size());
+                    state = FRAME_WAIT_SYNC;
+                }
+                break;
+            }
+        }
+    }
+    return length;
+}
+
+void CdcTransport::notify(const String& message) {
+    if (!connected() || message.length() == 0 || message.length() > MAX_MESSAGE_BYTES) {
+        return;
+    }
+    // 여러 태스크의 응답이 섞이지 않도록 헤더와 본문을 한 번에 씀
+    std::vector<uint8_t> frame(3 + message.length());
+    frame[0] = CDC_FRAME_SYNC;
+    frame[1] = (uint8_t)(message.length() & 0xFF);
+    frame[2] = (uint8_t)(message.length() >> 8);
+    memcpy(frame.data() + 3, message.c_str(), message.length());
+    Serial.write(frame.data(), frame.size());
+}
+
+bool CdcTransport::connected() const {
+    return (bool)Serial;
+}
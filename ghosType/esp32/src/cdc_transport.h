@@ -0,0 +1,74 @@
+/**
+ * @file cdc_transport.h
+ * @brief USB CDC 시리얼 수신 경로
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 동글은 HID 키보드와 함께 CDC 시리얼 포트로도 열거되므로, 같은 호스트의 자동화 도구는
+ * BLE 대신 USB로 작업을 보낼 수 있습니다. BLE 쓰기 하나가 메시지 하나인 것과 달리
+ * 시리얼은 바이트 스트림이므로 메시지마다 동기 바이트와 길이를 붙입니다.
+ *
+ * 프레임: [CDC_FRAME_SYNC][길이 u16 LE][메시지...]
+ *
+ * 메시지 내용은 BLE와 같은 프로토콜(JSON, GHTYPE_ 접두사, 0xFF 바이너리 프레임)이며
+ * 응답도 같은 형식의 프레임으로 돌려보냅니다. 동기 바이트가 아닌 바이트는 버리므로
+ * 잘못된 프레임 뒤에도 다음 동기 바이트에서 다시 맞춰집니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "config.h"
+#include "transport.h"
+
+/**
+ * @brief USB CDC 수신 경로 클래스
+ *
+ * begin()이 코어 0에 수신 태스크를 만들고, notify()는 어느 태스크에서나 호출합니다.
+ */
+class CdcTransport : public ITransport {
+public:
+    CdcTransport();
+
+    const char* name() const override { return "cdc"; }
+
+    /**
+     * @brief 시리얼 포트와 수신 태스크 시작 (setup에서 한 번)
+     */
+    bool begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) override;
+
+    /**
+     * @brief 응답 전송 (호스트가 포트를 열지 않았으면 버림)
+     * @param message 응답 문자열
+     */
+    void notify(const String& message) override;
+
+    /**
+     * @brief 호스트가 포트를 열었는지 확인 (DTR)
+     */
+    bool connected() const override;
+
+    size_t mtu() const override { return MAX_MESSAGE_BYTES; }
+
+private:
+    enum FrameState {
+        FRAME_WAIT_SYNC,
+        FRAME_LENGTH_LOW,
+        FRAME_LENGTH_HIGH,
+        FRAME_PAYLOAD
+    };
+
+    static void receiveTask(void* parameter);
+
+    /**
+     * @brief 도착한 바이트를 읽어 완성된 메시지마다 전달
+     * @return 읽은 바이트 수 (0: 받은 데이터 없음)
+     */
+    size_t poll();
+
+    uint8_t state;
+    size_t expected;               ///< 현재 메시지 길이
+    std::vector<uint8_t> payload;  ///< 조립 중인 메시지
+    bool was_connected;            ///< 마지막으로 확인한 DTR 상태 (연결 알림용)
+};
@@ -0,0 +1,205 @@
+/**
+ * @file chunk_assembler.cpp
+ * @brief 청크 프로토콜 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "chunk_assembler.h"
+#include <rom/crc.h>
+
+// ============================================================================
+// ChunkIdSet
+// ============================================================================
+
+ChunkIdSet::ChunkIdSet() : slots(NULL), count(0), reset_count(0) {
+}
+
+ChunkIdSet::~ChunkIdSet() {
+    free(slots);
+}
+
+size_t ChunkIdSet::slotFor(uint32_t id) {
+    // 피보나치 해싱 - 연속된 번호도 슬롯 전체에 고르게 분산
+    return (size_t)((id * 2654435769u) & (CHUNK_ID_SET_SLOTS - 1));
+}
+
+bool ChunkIdSet::contains(uint32_t id) const {
+    if (!slots) {
+        return false;
+    }
+    size_t slot = slotFor(id);
+    while (slots[slot] != CHUNK_ID_EMPTY) {
+        if (slots[slot] == id) {
+            return true;
+        }
+        slot = (slot + 1) & (CHUNK_ID_SET_SLOTS - 1);
+    }
+    return false;
+}
+
+bool ChunkIdSet::insert(uint32_t id) {
+    if (id == CHUNK_ID_EMPTY) {
+        return false;
+    }
+    if (!slots) {
+        size_t size = CHUNK_ID_SET_SLOTS * sizeof(uint32_t);
+#ifdef BOARD_HAS_PSRAM
+        if (psramFound()) {
+            slots = (uint32_t*)ps_malloc(size);
+        }
+#endif
+        if (!slots) {
+            slots = (uint32_t*)malloc(size);
+        }
+        if (!slots) {
+            return true;  // 메모리 부족 - 중복 검사 없이 받음
+        }
+        memset(slots, 0xFF, size);
+    }
+    if (count >= CHUNK_ID_SET_MAX_LOAD) {
+        // 탐사 길이가 길어지기 전에 비움 (오래된 번호의 재전송은 드묾)
+        clear();
+        reset_count++;
+    }
+
+    size_t slot = slotFor(id);
+    while (slots[slot] != CHUNK_ID_EMPTY) {
+        if (slots[slot] == id) {
+            return false;
+        }
+        slot = (slot + 1) & (CHUNK_ID_SET_SLOTS - 1);
+    }
+    slots[slot] = id;
+    count++;
+    return true;
+}
+
+void ChunkIdSet::clear() {
+    if (slots) {
+        memset(slots, 0xFF, CHUNK_ID_SET_SLOTS * sizeof(uint32_t));
+    }
+    count = 0;
+}
+
+// ============================================================================
+// ChunkAssembler
+// ============================================================================
+
+ChunkAssembler::ChunkAssembler()
+    : active(false), skipping(false), chunk_id(0), expected_length(0),
+      expected_crc(0), received(0), running_crc(0), chunk_stats() {
+}
+
+static uint32_t readU32(const uint8_t* data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+ChunkResult ChunkAssembler::begin(const uint8_t* frame, size_t length) {
+    if (length < CHUNK_HEADER_LENGTH) {
+        return CHUNK_INVALID;
+    }
+    if (active) {
+        chunk_stats.abandoned++;
+    }
+    reset();
+
+    chunk_id = readU32(frame + 2);
+    expected_length = readU32(frame + 6);
+    expected_crc = readU32(frame + 10);
+
+    if (chunk_id == CHUNK_ID_EMPTY || expected_length > CHUNK_MAX_BYTES) {
+        chunk_stats.corrupt++;
+        return CHUNK_CORRUPT;
+    }
+
+    active = true;
+    if (seen_ids.contains(chunk_id)) {
+        // 재전송된 청크 - 바로 ACK하고 이어지는 데이터는 버림
+        chunk_stats.duplicates++;
+        skipping = true;
+        consume(frame + CHUNK_HEADER_LENGTH, length - CHUNK_HEADER_LENGTH);
+        return CHUNK_DUPLICATE;
+    }
+
+    payload.reserve(expected_length);
+    return consume(frame + CHUNK_HEADER_LENGTH, length - CHUNK_HEADER_LENGTH);
+}
+
+ChunkResult ChunkAssembler::append(const uint8_t* frame, size_t length) {
+    if (!active || length < 2) {
+        return CHUNK_INVALID;
+    }
+    return consume(frame + 2, length - 2);
+}
+
+ChunkResult ChunkAssembler::consume(const uint8_t* data, size_t length) {
+    if (received + length > expected_length) {
+        if (!skipping) {
+            chunk_stats.corrupt++;
+        }
+        bool was_skipping = skipping;
+        reset();
+        return was_skipping ? CHUNK_PENDING : CHUNK_CORRUPT;
+    }
+
+    received += length;
+    if (skipping) {
+        if (received == expected_length) {
+            reset();
+        }
+        return CHUNK_PENDING;
+    }
+
+    // 도착한 만큼만 CRC 누적 - 완료 시 별도 검증 패스가 필요 없음
+    running_crc = crc32_le(running_crc, data, length);
+    payload.concat((const char*)data, length);
+
+    if (received < expected_length) {
+        return CHUNK_PENDING;
+    }
+
+    active = false;
+    if (running_crc != expected_crc) {
+        chunk_stats.corrupt++;
+        payload = String();
+        return CHUNK_CORRUPT;
+    }
+
+    chunk_stats.completed++;
+    return CHUNK_COMPLETE;
+}
+
+void ChunkAssembler::accept() {
+    seen_ids.insert(chunk_id);
+}
+
+void ChunkAssembler::takePayload(String& out) {
+    out = payload;
+    payload = String();
+}
+
+void ChunkAssembler::reset() {
+    active = false;
+    skipping = false;
+    expected_length = 0;
+    expected_crc = 0;
+    received = 0;
+    running_crc = 0;
+    payload = String();
+}
+
+String ChunkAssembler::statsJson() const {
+    String json = "{\"ok\":";
+    json += chunk_stats.completed;
+    json += ",\"dup\":";
+    json += chunk_stats.duplicates;
+    json += ",\"crc_err\":";
+    json += chunk_stats.corrupt;
+    json += ",\"abandoned\":";
+    json += chunk_stats.abandoned;
+    json += ",\"ids\":";
+    json += (unsigned int)seen_ids.size();
+    json += "}";
+    return json;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file chunk_assembler.h
+ * @brief 청크 프로토콜 - 중복 검사 및 CRC32 무결성 검사
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 긴 텍스트를 번호가 붙은 청크로 나누어 받습니다. 청크 하나가 BLE 쓰기
+ * 한 번보다 크면 시작 프레임과 이어지는 연속 프레임으로 나누어 전송되고,
+ * CRC32는 데이터가 도착할 때마다 ROM의 crc32_le로 누적 계산합니다.
+ * 처리한 청크 번호는 개방 주소법 해시 집합에 보관해 O(1)로 중복을 거릅니다.
+ *
+ * 시작 프레임: [0xFF][0x03][청크 번호 u32 LE][길이 u32 LE][CRC32 u32 LE][데이터...]
+ * 연속 프레임: [0xFF][0x04][데이터...]
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * @brief 청크 프레임 처리 결과
+ */
+enum ChunkResult {
+    CHUNK_PENDING = 0,    ///< 데이터가 더 필요함 (또는 중복 청크의 나머지를 버리는 중)
+    CHUNK_COMPLETE,       ///< 수신 완료, CRC 일치
+    CHUNK_DUPLICATE,      ///< 이미 받은 청크 번호
+    CHUNK_CORRUPT,        ///< CRC 불일치 또는 길이 초과
+    CHUNK_INVALID         ///< 잘못된 프레임 (시작 프레임 없는 연속 프레임 등)
+};
+
+/**
+ * @brief 청크 번호 집합 (개방 주소법, 선형 탐사)
+ *
+ * 슬롯이 CHUNK_ID_SET_MAX_LOAD를 넘으면 전체를 비우고 새로 시작합니다.
+ * 0xFFFFFFFF는 빈 슬롯 표시로 쓰이므로 청크 번호로 사용할 수 없습니다.
+ * 클라이언트마다 하나씩 있으므로 슬롯 배열은 첫 청크를 받을 때 할당합니다 (PSRAM 우선).
+ */
+class ChunkIdSet {
+public:
+    ChunkIdSet();
+    ~ChunkIdSet();
+    ChunkIdSet(const ChunkIdSet&) = delete;
+    ChunkIdSet& operator=(const ChunkIdSet&) = delete;
+
+    bool contains(uint32_t id) const;
+
+    /**
+     * @brief 청크 번호 추가
+     * @param id 청크 번호
+     * @return true 새로 추가됨 (슬롯 할당에 실패하면 기록 없이 true), false 이미 있음
+     */
+    bool insert(uint32_t id);
+
+    void clear();
+    size_t size() const { return count; }
+    uint32_t resets() const { return reset_count; }
+
+private:
+    uint32_t* slots;                     ///< CHUNK_ID_SET_SLOTS개의 청크 번호 (CHUNK_ID_EMPTY: 빈 슬롯, NULL: 할당 전)
+    size_t count;                        ///< 저장된 번호 수
+    uint32_t reset_count;                ///< 용량 초과로 비운 횟수
+
+    static size_t slotFor(uint32_t id);
+};
+
+/**
+ * @brief 청크 통계
+ */
+struct ChunkStats {
+    uint32_t completed;       ///< 정상 수신한 청크 수
+    uint32_t duplicates;      ///< 중복으로 거른 청크 수
+    uint32_t corrupt;         ///< CRC 불일치/길이 초과 청크 수
+    uint32_t abandoned;       ///< 완료 전에 다음 시작 프레임이 온 청크 수
+};
+
+/**
+ * @brief 청크 재조립기
+ *
+ * BLE 쓰기 콜백에서만 호출됩니다 (한 번에 하나의 청크만 조립).
+ */
+class ChunkAssembler {
+public:
+    ChunkAssembler();
+
+    /**
+     * @brief 시작 프레임 처리
+     * @param frame 프레임 전체 (0xFF 0x03 포함)
+     * @param length 프레임 길이
+     * @return 처리 결과
+     */
+    ChunkResult begin(const uint8_t* frame, size_t length);
+
+    /**
+     * @brief 연속 프레임 처리
+     * @param frame 프레임 전체 (0xFF 0x04 포함)
+     * @param length 프레임 길이
+     * @return 처리 결과
+     */
+    ChunkResult append(const uint8_t* frame, size_t length);
+
+    /**
+     * @brief 마지막으로 처리한 청크 번호 (ACK/NACK 응답용)
+     */
+    uint32_t chunkId() const { return chunk_id; }
+
+    /**
+     * @brief 완료된 청크 데이터 꺼내기
+     * @param[out] out 데이터 (UTF-8 텍스트)
+     */
+    void takePayload(String& out);
+
+    /**
+     * @brief 완료된 청크를 처리한 번호로 기록
+     *
+     * 작업 대기열에 추가된 뒤에 호출합니다. 대기열이 가득 차서 거부된 청크는
+     * 기록하지 않으므로 클라이언트가 재전송하면 다시 받습니다.
+     */
+    void accept();
+
+    /**
+     * @brief 조립 중인 청크인지 (중복 청크를 버리는 중이면 false)
+     */
+    bool assembling() const { return active && !skipping; }
+
+    /**
+     * @brief 조립 중인 청크의 받은 바이트 (세션 재개 시 연속 프레임을 이어 보낼 위치)
+     */
+    uint32_t receivedBytes() const { return assembling() ? received : 0; }
+
+    const ChunkStats& stats() const { return chunk_stats; }
+
+    /**
+     * @brief 청크 상태를 JSON 객체 문자열로 변환
+     * @return 예: {"ok":120,"dup":2,"crc_err":1,"abandoned":0,"ids":122}
+     */
+    String statsJson() const;
+
+private:
+    ChunkIdSet seen_ids;      ///< 처리한 청크 번호
+    bool active;              ///< 조립 중인 청크 여부
+    bool skipping;            ///< 중복 청크의 나머지 데이터를 버리는 중
+    uint32_t chunk_id;        ///< 현재 청크 번호
+    uint32_t expected_length; ///< 전체 데이터 길이
+    uint32_t expected_crc;    ///< 클라이언트가 보낸 CRC32
+    uint32_t received;        ///< 지금까지 받은 길이
+    uint32_t running_crc;     ///< 누적 CRC32
+    String payload;           ///< 조립 중인 데이터
+    ChunkStats chunk_stats;   ///< 통계
+
+    ChunkResult consume(const uint8_t* data, size_t length);
+    void reset();
+};
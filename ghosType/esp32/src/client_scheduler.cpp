@@ -0,0 +1,91 @@
+/**
+ * @file client_scheduler.cpp
+ * @brief 클라이언트별 벌크 레인과 가중 공정 스케줄 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "client_scheduler.h"
+
+ClientScheduler::Client::Client(const char* name)
+    : lane(name, BULK_LANE_CAPACITY, BULK_LANE_MAX_BYTES), last_tag(0), weight(SCHED_WEIGHT_DEFAULT),
+      served(0), served_bytes(0) {
+}
+
+ClientScheduler::ClientScheduler() : virtual_time(0) {
+}
+
+uint8_t ClientScheduler::addClient(const char* name) {
+    clients.push_back(Client(name));
+    return (uint8_t)(clients.size() - 1);
+}
+
+bool ClientScheduler::push(uint8_t client, const String& data, uint32_t now_ms) {
+    Client& c = clients[client];
+    if (!c.lane.push(data, now_ms, 0, client)) {
+        return false;
+    }
+    // 쉬던 클라이언트는 현재 가상 시각부터 - 쉬는 동안 쌓인 몫을 한꺼번에 쓰지 못하게
+    uint64_t start = c.last_tag > virtual_time ? c.last_tag : virtual_time;
+    uint64_t cost = (uint64_t)(data.length() + SCHED_JOB_COST_BYTES) * SCHED_TAG_SCALE / c.weight;
+    c.last_tag = start + cost;
+    c.tags.push_back(c.last_tag);
+    return true;
+}
+
+bool ClientScheduler::pop(QueuedMessage& out, uint32_t now_ms) {
+    Client* next = NULL;
+    for (Client& c : clients) {
+        if (!c.tags.empty() && (!next || c.tags.front() < next->tags.front())) {
+            next = &c;
+        }
+    }
+    if (!next || !next->lane.pop(out, now_ms)) {
+        return false;
+    }
+    virtual_time = next->tags.front();
+    next->tags.pop_front();
+    next->served++;
+    next->served_bytes += out.data.length();
+    return true;
+}
+
+bool ClientScheduler::setWeight(uint8_t client, int weight) {
+    if (weight < 1 || weight > SCHED_WEIGHT_MAX) {
+        return false;
+    }
+    clients[client].weight = weight;
+    return true;
+}
+
+size_t ClientScheduler::size() const {
+    size_t total = 0;
+    for (const Client& c : clients) {
+        total += c.lane.size();
+    }
+    return total;
+}
+
+String ClientScheduler::statsJson() const {
+    String json = "{\"depth\":";
+    json += (unsigned int)size();
+    json += ",\"vtime\":";
+    json += (unsigned long)(virtual_time / SCHED_TAG_SCALE);
+    json += ",\"clients\":{";
+    for (size_t i = 0; i < clients.size(); i++) {
+        const Client& c = clients[i];
+        json += i ? ",\"" : "\"";
+        json += c.lane.name();
+        json += "\":{\"weight\":";
+        json += c.weight;
+        json += ",\"served\":";
+        json += c.served;
+        json += ",\"served_bytes\":";
+        json += c.served_bytes;
+        json += ",\"lane\":";
+        json += c.lane.statsJson();
+        json += "}";
+    }
+    json += "}}";
+    return json;
+}
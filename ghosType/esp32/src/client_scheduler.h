@@ -0,0 +1,100 @@
+/**
+ * @file client_scheduler.h
+ * @brief 클라이언트별 벌크 레인과 작업 경계 가중 공정 스케줄
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 클라이언트(수신 경로 하나)마다 벌크 레인을 따로 두므로 두 번째 클라이언트의 텍스트가
+ * 첫 번째 클라이언트의 작업 사이에 섞여 들어가지 않습니다. 컴파일 태스크가 다음 작업을
+ * 꺼낼 때(작업 경계)만 어느 클라이언트 차례인지 정하고, 작업 하나는 끝까지 이어서 입력합니다.
+ *
+ * 차례는 가중 공정 큐(WFQ)의 종료 태그로 정합니다. 작업이 들어오면
+ *   태그 = max(가상 시각, 그 클라이언트의 마지막 태그) + (바이트 + SCHED_JOB_COST_BYTES) x 배율 / 가중치
+ * 를 붙이고, 각 레인 맨 앞 작업 중 태그가 가장 작은 것을 꺼낸 뒤 가상 시각을 그 태그로 옮깁니다.
+ * 큰 붙여넣기는 태그가 커서 나중에 온 짧은 작업이 먼저 나가고, 계속 짧은 작업을 보내는
+ * 클라이언트도 보낸 바이트만큼 태그가 늘어 다른 클라이언트를 굶기지 못합니다.
+ * 레인마다 개수(BULK_LANE_CAPACITY)와 바이트(BULK_LANE_MAX_BYTES) 한도가 따로 있습니다.
+ *
+ * 동기화는 호출하는 쪽에서 담당합니다 (main.cpp의 queueMutex).
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+#include "config.h"
+#include "message_lane.h"
+
+/**
+ * @brief 클라이언트별 벌크 레인 스케줄러
+ */
+class ClientScheduler {
+public:
+    ClientScheduler();
+
+    /**
+     * @brief 클라이언트 추가 (setup에서 수신 경로마다, 번호는 추가한 순서)
+     * @param name 상태 보고에 쓸 이름 (수신 경로 이름)
+     * @return 클라이언트 번호
+     */
+    uint8_t addClient(const char* name);
+
+    /**
+     * @brief 작업 추가
+     * @return false 그 클라이언트의 레인이 가득 참 (다른 클라이언트와 무관)
+     */
+    bool push(uint8_t client, const String& data, uint32_t now_ms);
+
+    /**
+     * @brief 다음 차례 작업 꺼내기
+     * @param[out] out 꺼낸 작업 (out.client가 보낸 클라이언트)
+     * @return false 모든 레인이 비어 있음
+     */
+    bool pop(QueuedMessage& out, uint32_t now_ms);
+
+    /**
+     * @brief 가중치 설정 (이후 들어오는 작업부터 적용)
+     * @param weight 가중치 (1~SCHED_WEIGHT_MAX)
+     * @return false 범위를 벗어남 (기존 가중치 유지)
+     */
+    bool setWeight(uint8_t client, int weight);
+    uint8_t weight(uint8_t client) const { return clients[client].weight; }
+
+    /**
+     * @brief 대기 중인 작업 수 (전체 / 클라이언트 하나)
+     */
+    size_t size() const;
+    size_t size(uint8_t client) const { return clients[client].lane.size(); }
+
+    /**
+     * @brief 클라이언트 작업 중 꺼낸(컴파일/타이핑으로 넘긴) 수
+     */
+    uint32_t served(uint8_t client) const { return clients[client].served; }
+
+    /**
+     * @brief 클라이언트가 지금까지 추가한 작업 수 (한영 전환 장벽)
+     */
+    uint32_t enqueued(uint8_t client) const { return clients[client].lane.stats().enqueued; }
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"depth":n,"vtime":n,"clients":{"ble":{"weight":1,"served":n,"served_bytes":n,"lane":{...}},...}}
+     */
+    String statsJson() const;
+
+private:
+    struct Client {
+        MessageLane lane;
+        std::deque<uint64_t> tags;   ///< 레인의 작업마다 종료 태그 (레인과 같은 순서)
+        uint64_t last_tag;           ///< 마지막으로 추가한 작업의 태그
+        uint8_t weight;
+        uint32_t served;             ///< 꺼낸 작업 수
+        uint32_t served_bytes;       ///< 꺼낸 작업 바이트
+
+        explicit Client(const char* name);
+    };
+
+    std::vector<Client> clients;
+    uint64_t virtual_time;           ///< 마지막으로 꺼낸 작업의 태그
+};
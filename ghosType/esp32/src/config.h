@@ -31,9 +31,28 @@
 #define BLE_CHAR_TX_UUID "12345678-1234-5678-9012-123456789abe"  // 서버 → 클라이언트
 
 // BLE 연결 파라미터
-#define BLE_MIN_CONN_INTERVAL 0x06   // 7.5ms
-#define BLE_MAX_CONN_INTERVAL 0x12   // 22.5ms
-#define BLE_TIMEOUT_MULTIPLIER 0x33  // 510ms
+#define BLE_MTU 247                  // 요청 MTU (안정성과 호환성)
+#define BLE_ATT_HEADER 3             // 쓰기/알림 하나의 ATT 헤더 (MTU에서 제외)
+#define BLE_MAX_CENTRALS 2           // 동시에 연결하는 중앙 장치 수 (연결마다 클라이언트 하나, 스택 최대 연결 수 이하)
+#define BLE_ADV_FAST_MIN 0x20        // 부팅/연결 해제 직후 광고 간격 최소 (0.625ms 단위, 20ms)
+#define BLE_ADV_FAST_MAX 0x30        // 부팅/연결 해제 직후 광고 간격 최대 (30ms)
+#define BLE_ADV_SLOW_MIN 0xA0        // 빠른 광고 구간 이후 간격 최소 (100ms)
+#define BLE_ADV_SLOW_MAX 0xF0        // 빠른 광고 구간 이후 간격 최대 (150ms)
+#define BLE_ADV_FAST_WINDOW_MS 30000 // 빠른 간격으로 광고하는 시간
+#define BLE_MIN_CONN_INTERVAL 0x06   // 7.5ms - 광고에 싣는 선호 간격이자 대량 전송 중 요청 간격 (1.25ms 단위)
+#define BLE_MAX_CONN_INTERVAL 0x0C   // 15ms
+#define BLE_TIMEOUT_MULTIPLIER 0x33  // 510ms (10ms 단위)
+#define BLE_IDLE_MIN_CONN_INTERVAL 0x18  // 30ms - 유휴 시 완화한 간격
+#define BLE_IDLE_MAX_CONN_INTERVAL 0x28  // 50ms
+#define BLE_IDLE_SLAVE_LATENCY 4         // 유휴 시 건너뛸 수 있는 연결 이벤트 수
+#define BLE_IDLE_TIMEOUT 0xC8            // 2s (> (1 + 지연) x 최대 간격 x 2)
+#define BLE_DATA_LENGTH_MAX 251          // LE 데이터 길이 확장 최대 (MTU 247 + L2CAP 헤더 4 = 패킷 하나)
+
+// 링크 관리 (link_manager.h)
+#define LINK_BULK_MESSAGE_BYTES 128  // 이보다 큰 메시지와 청크/스트림 프레임은 대량 전송으로 봄
+#define LINK_RELAX_AFTER_MS 3000     // 대량 전송이 이만큼 없으면 연결 간격 완화
+#define LINK_REQUEST_GAP_MS 1000     // 연결 파라미터 요청 최소 간격 (중앙 장치가 잦은 요청을 거부함)
+#define LINK_TICK_MS 250             // 완화/재요청을 확인하는 주기
 
 // ============================================================================
 // 타이핑 설정
@@ -48,6 +67,39 @@
 #define KEY_RELEASE_DURATION_MS 20   // 키를 놓는 시간
 #define SHIFT_HOLD_DURATION_MS 20    // Shift 키 홀드 시간
 
+// 특수 키 지연 (타이핑 루프와 예상 완료 시간 계산이 함께 사용)
+#define ENTER_PRE_DELAY_MS 50        // 엔터키 전 지연
+#define ENTER_HOLD_MS 100            // 엔터키 누름 유지
+#define ENTER_POST_DELAY_MS 100      // 엔터키 후 지연
+#define TAB_HOLD_MS 50               // 탭키 누름 유지
+#define TAB_POST_DELAY_MS 50         // 탭키 후 지연
+#define HANENG_PRESS_DELAY_MS 10     // 한영 전환 Alt, Shift 누름 간격
+#define HANENG_SETTLE_MS 50          // 한영 전환 후 IME 안정화 대기
+
+// 한글 조합 전환별 최소 키 간격 (ime_pacing.h, CFG ime_gap으로 조정)
+#define IME_GAP_CARRY_MS 45          // 받침으로 붙은 자음 → 모음 (자음이 다음 음절로 이동)
+#define IME_GAP_COMPOUND_VOWEL_MS 30 // 겹모음 첫 키 → 둘째 키
+#define IME_GAP_COMPOUND_FINAL_MS 30 // 겹받침 첫 키 → 둘째 키
+#define IME_GAP_MAX_MS 500           // 설정 가능한 최대 간격
+
+// 키 간격 절대 시각 예약 (key_pacer.h)
+#define PACING_SPIN_US 1500          // 마감 직전 이만큼은 delay() 대신 delayMicroseconds()로 맞춤 (틱 1ms 오차 제거)
+#define PACING_MAX_LAG_US 20000      // 마감보다 이만큼 넘게 늦으면 따라잡지 않고 지금 시각으로 다시 기준을 잡음
+#define PACING_MIN_INTERVAL_PCT 90   // 늦은 만큼 따라잡을 때도 키 사이는 간격의 이 비율 아래로 줄이지 않음
+#define PACING_JITTER_BOUNDS_US 50, 100, 250, 500, 1000, 2000, 5000  // 리포트 시각 오차 히스토그램 구간
+
+// 호스트 동기화 장벽 (host_sync.h, CFG adaptive로 켬)
+#define SYNC_LOCK_KEY 0xCF           // 장벽에 쓰는 잠금 키 (KEY_SCROLL_LOCK, 두 번 눌러 원래 상태로 복원)
+#define SYNC_LOCK_LED 0x04           // 잠금 키의 LED 비트 (HID_LED_SCROLL_LOCK)
+#define SYNC_BARRIER_INTERVAL_KEYS 40  // 장벽 사이의 일반 키 수
+#define SYNC_BARRIER_TIMEOUT_MS 200  // LED 응답 최대 대기
+#define SYNC_MAX_TIMEOUTS 3          // 이만큼 연속 무응답이면 장벽을 멈추고 speed_cps로 복귀
+#define SYNC_LAG_THRESHOLD_MS 12     // 최소 왕복 시간보다 이만큼 느리면 호스트가 밀린 것으로 판단
+#define SYNC_MIN_KEY_GAP_MS 4        // 적응형 모드의 최소 키 간격 (리포트 2개 + 여유)
+#define SYNC_SPEEDUP_PERCENT 90      // 따라올 때 키 간격 비율
+#define SYNC_SLOWDOWN_PERCENT 150    // 밀리거나 무응답일 때 키 간격 비율
+#define SYNC_MAX_GAP_PERCENT 300     // 늘어난 키 간격의 상한 (시작 간격 대비 비율)
+
 // 타이핑 간격 설정
 #define DEFAULT_INTERVAL_MS 100      // 기본 간격 지연
 #define DEFAULT_INTERVAL_CHARS 5     // 간격 지연을 적용할 문자 수
@@ -60,6 +112,36 @@
 #define PROTOCOL_JSON_START '{'
 #define PROTOCOL_JSON_END '}'
 
+// 제어 레인으로 분류되는 명령 접두사
+#define PROTOCOL_CONFIG "GHTYPE_CFG:"   // 설정 변경
+#define PROTOCOL_HANENG "GHTYPE_SPE:haneng"  // 한영 전환 (앞선 텍스트 뒤에 실행)
+#define PROTOCOL_STATUS "GHTYPE_STS"    // 상태/통계 조회
+#define PROTOCOL_SESSION "GHTYPE_SES:"  // 세션 시작/재개 {"token":"1a2b3c4d"} (session_manager.h)
+
+// 스니펫 정의 (벌크 레인, 순서 유지): GHTYPE_SNP:{"id":3,"text":"..."}
+#define PROTOCOL_SNIPPET "GHTYPE_SNP:"
+
+// 바이너리 프레임 - 유효한 UTF-8에 나타나지 않는 0xFF로 시작
+#define FRAME_MARKER 0xFF
+#define FRAME_SNIPPET_INVOKE 0x01    // [0xFF][0x01][id 하위][id 상위][매개변수 0x1F 구분]
+#define FRAME_PARAM_SEPARATOR 0x1F   // 매개변수 구분자
+#define FRAME_CACHE_PROBE 0x02       // [0xFF][0x02][해시 u32 LE][텍스트 길이 u32 LE]
+#define FRAME_CACHE_PROBE_LENGTH 10
+#define FRAME_CHUNK_BEGIN 0x03       // [0xFF][0x03][번호 u32][길이 u32][CRC32 u32][데이터...] (LE)
+#define FRAME_CHUNK_CONTINUE 0x04    // [0xFF][0x04][데이터...]
+#define FRAME_CHUNK_JOB 0x05         // 내부용: 검증된 청크 작업 [0xFF][0x05][번호 u32][데이터...]
+#define FRAME_MIRROR_CONTROL 0x06    // [0xFF][0x06][1: 미러 시작 / 0: 종료]
+#define FRAME_MIRROR_KEYS 0x07       // [0xFF][0x07][UTF-8 글자...] (미러 세션 중에만, 커서 위치에 삽입)
+#define FRAME_MIRROR_EDIT 0x08       // [0xFF][0x08][시작 u32][끝 u32][UTF-8 새 텍스트...] (LE, 코드 포인트 위치)
+#define FRAME_MIRROR_EDIT_HEADER 10
+#define FRAME_STREAM_BEGIN 0x09      // [0xFF][0x09][작업 JSON 또는 텍스트 앞부분...] (받는 즉시 타이핑 시작)
+#define FRAME_STREAM_CONTINUE 0x0A   // [0xFF][0x0A][이어지는 데이터...]
+#define FRAME_STREAM_END 0x0B        // [0xFF][0x0B]
+#define FRAME_STREAM_JOB 0x0C        // 내부용: 스트림 작업의 벌크 레인 자리 [0xFF][0x0C]
+#define FRAME_SEQUENCED 0x0D         // [0xFF][0x0D][플래그 u8][순번 u16 LE][메시지...] (응답 없는 쓰기용, frame_sequencer.h)
+#define FRAME_SEQUENCED_HEADER 5
+#define FRAME_SEQ_ACK_NOW 0x01       // 플래그: 곧바로 SACK 응답 요청 (묶음의 마지막 프레임)
+
 // 토글 마커
 #define TOGGLE_MARKER "⌨HANGUL_TOGGLE⌨"
 #define TOGGLE_MARKER_LENGTH 15
@@ -68,14 +150,88 @@
 #define JSON_FIELD_TEXT "text"
 #define JSON_FIELD_SPEED "speed_cps"
 #define JSON_FIELD_INTERVAL "interval_ms"
+#define JSON_FIELD_PROGRESS "progress_ms"  // 진행 알림 주기 (0: 끔)
+#define JSON_FIELD_LAYOUT "layout"          // 호스트 키보드 배열 (us, ko, de, dvorak)
+#define JSON_FIELD_IME_GAP "ime_gap"        // 조합 전환별 최소 간격 [["carry","jung",45], ...]
+#define JSON_FIELD_ADAPTIVE "adaptive"      // LED 동기화 장벽으로 속도 자동 조절 (true/false)
+#define JSON_FIELD_IME_LED "ime_led"        // 호스트 IME가 한글 모드를 Kana LED로 표시 (true/false)
+#define JSON_FIELD_WEIGHT "weight"          // 대량 레인 가중치 (1~SCHED_WEIGHT_MAX, 클라이언트끼리 경쟁할 때의 몫)
 
 // ============================================================================
 // 메모리 및 버퍼 설정
 // ============================================================================
 #define MAX_MESSAGE_LENGTH 512       // 최대 메시지 길이
+#define MAX_MESSAGE_BYTES 10000      // 수신 메시지 하나의 최대 크기 (BLE 쓰기, CDC 프레임 공통)
 #define MAX_TEXT_CHUNK_SIZE 256      // 텍스트 청크 최대 크기
 #define TYPING_BUFFER_SIZE 1024      // 타이핑 버퍼 크기
 
+// 수신 레인 용량 (메시지 개수)
+#define CONTROL_LANE_CAPACITY 16     // 제어 레인 (설정, 한영 전환, 상태 조회)
+#define BULK_LANE_CAPACITY 32        // 벌크 레인 (텍스트 작업) - 클라이언트마다
+#define BULK_LANE_MAX_BYTES 32768    // 클라이언트 하나가 쌓아 둘 수 있는 작업 바이트 (큰 붙여넣기가 메모리를 독차지하지 않도록)
+
+// 클라이언트별 작업 스케줄 (client_scheduler.h)
+#define SCHED_JOB_COST_BYTES 64      // 작업 하나의 고정 비용 (짧은 작업도 공짜가 아님)
+#define SCHED_WEIGHT_DEFAULT 1       // 클라이언트 기본 가중치
+#define SCHED_WEIGHT_MAX 8           // CFG weight 최대값
+#define SCHED_TAG_SCALE 840          // 가상 시각 배율 (1~8로 나누어떨어짐)
+
+// 스니펫 저장소
+#define SNIPPET_NVS_NAMESPACE "snippets"
+#define SNIPPET_FORMAT_VERSION 4     // 키 이벤트 형식이 바뀌면 증가 (2: HID 키 코드 + 수정키, 3: 조합 역할, 4: 글자 끝 표시)
+#define SNIPPET_NVS_MAX_BYTES 1984   // 이 크기 이하는 NVS, 초과는 SPIFFS
+#define SNIPPET_MAX_BYTES 65536      // 스니펫 하나의 최대 저장 크기
+#define SNIPPET_MAX_PARAMS 10        // {0}~{9}
+
+// 컴파일된 작업 캐시 (PSRAM)
+#define JOB_CACHE_MAX_ENTRIES 16     // 최대 항목 수
+#define JOB_CACHE_MAX_BYTES (512 * 1024)  // 이벤트 버퍼 총량
+#define JOB_CACHE_MIN_TEXT 256       // 이보다 짧은 텍스트는 다시 보내는 편이 빠름
+
+// 청크 프로토콜
+#define CHUNK_HEADER_LENGTH 14       // 시작 프레임 헤더 크기
+#define CHUNK_MAX_BYTES 8192         // 청크 하나의 최대 데이터 크기
+#define CHUNK_ID_SET_SLOTS 4096      // 청크 번호 집합 슬롯 수 (2의 거듭제곱)
+#define CHUNK_ID_SET_MAX_LOAD 3072   // 이 개수를 넘으면 집합을 비움 (부하율 75%)
+#define CHUNK_ID_EMPTY 0xFFFFFFFFu   // 빈 슬롯 표시 (청크 번호로 사용 불가)
+
+// 작업 파이프라인 (수신/컴파일 코어 0, 타이핑 코어 1)
+#define PIPELINE_DEPTH 2             // 컴파일을 마치고 타이핑을 기다릴 수 있는 작업 수
+#define PIPELINE_COMPILE_STACK 16384 // 컴파일 태스크 스택 (8KB JSON 문서 포함)
+#define PIPELINE_COMPILE_PRIORITY 1  // BLE 스택 태스크보다 낮음
+#define PIPELINE_IDLE_WAIT_MS 100    // 알림 없이 벌크 레인을 다시 확인하는 주기
+
+// 스트리밍 수신 (다 받기 전에 타이핑 시작)
+#define STREAM_RING_EVENTS 4096          // 키 이벤트 링 버퍼 (내부 RAM, 2의 거듭제곱)
+#define STREAM_RING_EVENTS_PSRAM 65536   // PSRAM이 있을 때 (2의 거듭제곱)
+#define STREAM_STALL_TIMEOUT_MS 10000    // 다음 데이터를 기다리는 최대 시간 (넘으면 스트림 중단)
+#define STREAM_PAUSE_FREE_EVENTS 1024    // 링 버퍼 빈자리가 이보다 적으면 STREAM:pause (전송 중인 조각이 들어갈 자리)
+#define STREAM_BACKLOG_EVENTS 2048       // STREAM:pause 뒤에 도착해 링 버퍼에 못 넣은 이벤트 최대 수 (넘으면 중단)
+
+// USB CDC 수신 경로
+#define CDC_FRAME_SYNC 0xA5              // 프레임 시작 바이트 - [0xA5][길이 u16 LE][메시지]
+#define CDC_RX_BUFFER_SIZE 8192          // CDC 수신 버퍼
+#define CDC_READ_CHUNK 512               // 한 번에 읽는 바이트 수
+#define CDC_TASK_STACK 8192              // CDC 수신 태스크 스택
+#define CDC_IDLE_WAIT_MS 1               // 받은 데이터가 없을 때 다시 확인하는 주기
+#define TRANSPORT_RATE_WINDOW_MS 1000    // 수신 경로별 처리량 계산 구간
+#define SEQ_WINDOW 32                    // 순번 프레임 수신 창 (순서가 어긋난 프레임 보관, SACK 비트맵 폭)
+#define SEQ_ACK_EVERY 8                  // 이만큼 차례로 받을 때마다 SACK 응답
+
+// 라이브 미러
+#define MIRROR_QUEUE_LENGTH 64       // BLE 태스크 → HID 루프 키 큐 길이
+#define MIRROR_IDLE_WAIT_MS 10       // 유휴 루프가 미러 키를 기다리는 시간 (예전 delay(10) 대체)
+#define SHADOW_MAX_CHARS 8192        // 편집용 텍스트 사본 최대 길이 (넘으면 커서 앞 오래된 부분부터 버림)
+#define MIRROR_LATENCY_BOUNDS_US 1000, 2000, 5000, 10000, 20000, 50000, 100000  // 지연 히스토그램 구간
+
+// 세션 재개 (session_manager.h)
+#define SESSION_RESUME_WINDOW_MS 30000  // 연결이 끊긴 뒤 세션을 유지하는 시간 (넘으면 새 세션)
+#define SESSION_HELD_MAX 16             // 끊긴 동안 보관하는 응답 수 (넘으면 오래된 것부터 버림, 진행 알림은 보관 안 함)
+
+// 부팅 (boot_profile.h)
+#define BOOT_HID_WAIT_MS 3000        // 부팅 후 USB 열거를 기다리는 최대 시간 (그 전에 온 작업은 열거 후 타이핑)
+#define BOOT_SERIAL_WAIT_MS 2000     // 디버그 빌드에서 시리얼 모니터를 기다리는 최대 시간
+
 // ============================================================================
 // 타임아웃 설정
 // ============================================================================
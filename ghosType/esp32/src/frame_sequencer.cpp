@@ -0,0 +1,118 @@
+/**
+ * @file frame_sequencer.cpp
+ * @brief 순번 프레임 수신 창 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "frame_sequencer.h"
+
+FrameSequencer::FrameSequencer()
+    : next_seq(0), acked_seq(0), received_bits(0), frames(0), gaps(0), reordered(0),
+      duplicates(0), dropped(0), invalid(0), acks(0) {
+}
+
+void FrameSequencer::reset() {
+    next_seq = 0;
+    acked_seq = 0;
+    received_bits = 0;
+    for (size_t i = 0; i < SEQ_WINDOW; i++) {
+        std::vector<uint8_t>().swap(slots[i]);  // 연결이 끝나면 보관 메모리도 돌려줌
+    }
+}
+
+bool FrameSequencer::receive(ITransport& from, const uint8_t* frame, size_t length, Handler deliver) {
+    if (length < FRAME_SEQUENCED_HEADER ||
+        isSequenced(frame + FRAME_SEQUENCED_HEADER, length - FRAME_SEQUENCED_HEADER)) {
+        invalid++;
+        return false;
+    }
+    uint8_t flags = frame[2];
+    uint16_t seq = (uint16_t)(frame[3] | (frame[4] << 8));
+    const uint8_t* body = frame + FRAME_SEQUENCED_HEADER;
+    size_t body_length = length - FRAME_SEQUENCED_HEADER;
+    bool ack = (flags & FRAME_SEQ_ACK_NOW) != 0;
+
+    if (body_length == 0) {
+        return true;  // SACK 요청만
+    }
+    frames++;
+
+    uint16_t offset = (uint16_t)(seq - next_seq);
+    if (offset == 0) {
+        bool had_gap = received_bits != 0;
+        deliver(from, body, body_length);
+        received_bits >>= 1;
+        next_seq++;
+        // 보관해 둔 다음 순번들을 이어서 처리
+        while (received_bits & 1) {
+            std::vector<uint8_t>& slot = slots[next_seq % SEQ_WINDOW];
+            deliver(from, slot.data(), slot.size());
+            slot.clear();
+            reordered++;
+            received_bits >>= 1;
+            next_seq++;
+        }
+        if (had_gap && received_bits == 0) {
+            ack = true;  // 빈자리가 모두 채워짐
+        }
+    } else if (offset < SEQ_WINDOW) {
+        uint32_t bit = 1UL << offset;
+        if (received_bits & bit) {
+            duplicates++;
+        } else {
+            if (received_bits == 0) {
+                gaps++;
+                ack = true;  // 빈자리가 처음 생김 - 클라이언트가 곧바로 재전송하도록
+            }
+            slots[seq % SEQ_WINDOW].assign(body, body + body_length);
+            received_bits |= bit;
+        }
+    } else if (offset >= 0x8000) {
+        duplicates++;  // 이미 처리한 순번 - 클라이언트가 SACK를 놓쳤으므로 다시 알림
+        ack = true;
+    } else {
+        dropped++;     // 창 밖 - 클라이언트가 SACK를 기다리지 않고 너무 앞서 보냄
+        ack = true;
+    }
+
+    if ((uint16_t)(next_seq - acked_seq) >= SEQ_ACK_EVERY) {
+        ack = true;
+    }
+    return ack;
+}
+
+String FrameSequencer::ackMessage() {
+    acked_seq = next_seq;
+    acks++;
+    char text[32];
+    snprintf(text, sizeof(text), "SACK:%u,%08lx", (unsigned int)next_seq, (unsigned long)received_bits);
+    return String(text);
+}
+
+String FrameSequencer::statsJson() const {
+    uint32_t pending = 0;
+    for (uint32_t bits = received_bits; bits; bits &= bits - 1) {
+        pending++;
+    }
+    String json = "{\"next\":";
+    json += next_seq;
+    json += ",\"frames\":";
+    json += frames;
+    json += ",\"gaps\":";
+    json += gaps;
+    json += ",\"reordered\":";
+    json += reordered;
+    json += ",\"dup\":";
+    json += duplicates;
+    json += ",\"dropped\":";
+    json += dropped;
+    json += ",\"invalid\":";
+    json += invalid;
+    json += ",\"acks\":";
+    json += acks;
+    json += ",\"pending\":";
+    json += pending;
+    json += "}";
+    return json;
+}
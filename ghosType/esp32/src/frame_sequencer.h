@@ -0,0 +1,90 @@
+/**
+ * @file frame_sequencer.h
+ * @brief 응답 없는 쓰기(Write Without Response)용 순번 프레임 - 손실 감지와 선택 재전송
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 응답 있는 쓰기는 쓰기마다 ATT 응답을 기다리므로 연결 이벤트 하나에 쓰기 하나만 보냅니다.
+ * 응답 없는 쓰기는 연결 이벤트 하나에 여러 패킷을 보내지만 장치가 받았는지 알려 주지 않으므로,
+ * 클라이언트는 대량 전송 프레임을 순번 프레임으로 감싸 보내고 손실은 순번과 SACK 비트맵으로 찾습니다.
+ *
+ *   [0xFF][0x0D][플래그 u8][순번 u16 LE][메시지...]
+ *
+ * 순번은 연결마다 0부터 시작하고 65535 다음은 0입니다. 장치는 차례가 된 메시지를 평소 수신과
+ * 똑같이 처리하고, 앞 순번이 빠진 메시지는 SEQ_WINDOW 안에서 보관했다가 빈자리가 채워지면
+ * 순서대로 처리합니다. 응답은 SACK:<다음 순번>,<비트맵 16진수 8자리>이며 비트 i는
+ * (다음 순번 + i)를 받았다는 뜻입니다 (비트 0은 항상 0 - 다음 순번은 아직 못 받음).
+ * SACK는 빈자리가 처음 생길 때, 빈자리가 채워질 때, SEQ_ACK_EVERY개마다, 플래그에
+ * FRAME_SEQ_ACK_NOW가 있을 때, 이미 받은 순번이나 창 밖 순번이 올 때 보냅니다.
+ * 메시지가 빈 순번 프레임은 순번을 쓰지 않고 SACK만 요청합니다.
+ *
+ * 경로마다 하나씩 있고(ITransport) 그 경로의 수신 태스크/콜백에서만 호출되므로 잠금은 없습니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "config.h"
+
+class ITransport;
+
+/**
+ * @brief 순번 프레임 수신 창
+ */
+class FrameSequencer {
+public:
+    /**
+     * @brief 차례가 된 메시지 처리 함수 (TransportReceiveHandler와 같은 형식)
+     */
+    typedef void (*Handler)(ITransport& from, const uint8_t* data, size_t length);
+
+    FrameSequencer();
+
+    /**
+     * @brief 순번 프레임인지 확인
+     */
+    static bool isSequenced(const uint8_t* data, size_t length) {
+        return length >= 2 && data[0] == FRAME_MARKER && data[1] == FRAME_SEQUENCED;
+    }
+
+    /**
+     * @brief 새 연결 - 순번 0부터, 보관한 메시지 버림
+     */
+    void reset();
+
+    /**
+     * @brief 순번 프레임 처리
+     * @param from 수신 경로 (deliver에 그대로 넘김)
+     * @param frame 프레임 전체 (0xFF 0x0D 포함)
+     * @param length 프레임 길이
+     * @param deliver 차례가 된 메시지마다 호출 (순번 순서)
+     * @return true SACK 응답을 보내야 함 (ackMessage())
+     */
+    bool receive(ITransport& from, const uint8_t* frame, size_t length, Handler deliver);
+
+    /**
+     * @brief 현재 수신 상태 응답 생성 - SACK:<다음 순번>,<비트맵> (보낸 것으로 기록)
+     */
+    String ackMessage();
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"next":n,"frames":n,"gaps":n,"reordered":n,"dup":n,"dropped":n,"invalid":n,"acks":n,"pending":n}
+     */
+    String statsJson() const;
+
+private:
+    uint16_t next_seq;        ///< 다음에 처리할 순번
+    uint16_t acked_seq;       ///< 마지막 SACK의 다음 순번
+    uint32_t received_bits;   ///< 비트 i: (next_seq + i)를 받아 보관 중
+    std::vector<uint8_t> slots[SEQ_WINDOW];  ///< 순서가 어긋난 메시지 (순번 % SEQ_WINDOW)
+
+    uint32_t frames;          ///< 받은 순번 프레임 수
+    uint32_t gaps;            ///< 빈자리가 생긴 횟수 (손실 또는 순서 어긋남)
+    uint32_t reordered;       ///< 보관했다가 처리한 메시지 수
+    uint32_t duplicates;      ///< 이미 받은 순번 (재전송)
+    uint32_t dropped;         ///< 창 밖 순번이라 버린 수
+    uint32_t invalid;         ///< 헤더가 짧거나 순번 프레임을 감싼 프레임
+    uint32_t acks;            ///< 보낸 SACK 수
+};
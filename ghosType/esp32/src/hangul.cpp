@@ -0,0 +1,119 @@
+/**
+ * @file hangul.cpp
+ * @brief 한글 음절 분해 검증
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 분해 표는 컴파일 시점에 만들어지므로 test_hangul_conversion.md의 변환 사례를
+ * static_assert로 컴파일 시점에 검사합니다. 표가 틀리면 빌드가 실패합니다.
+ */
+
+#include "hangul.h"
+
+namespace {
+
+// 한글 문자열(음절 또는 호환 자모)이 두벌식에서 expected 영문 키 순서로 입력되는지 확인
+constexpr bool typesAs(const char32_t* text, const char* expected) {
+    size_t e = 0;
+    for (size_t i = 0; text[i] != 0; i++) {
+        KeyStroke keys[HANGUL_MAX_SYLLABLE_KEYS] = {};
+        size_t count = 0;
+        if (Hangul::isSyllable(text[i])) {
+            count = Hangul::syllableKeys(text[i], keys);
+        } else if (Hangul::isJamo(text[i])) {
+            const KeyStroke* jamo = HANGUL_JAMO_KEYS.keys[text[i] - HANGUL_JAMO_FIRST];
+            for (size_t k = 0; k < 2 && jamo[k].usage != 0; k++) {
+                keys[count++] = jamo[k];
+            }
+        } else {
+            return false;
+        }
+
+        for (size_t k = 0; k < count; k++) {
+            if (expected[e] == '\0') {
+                return false;
+            }
+            KeyStroke want = KEYMAPS[LAYOUT_KO_2SET].keys[(uint8_t)expected[e++]];
+            if (keys[k].usage != want.usage || keys[k].modifiers != want.modifiers) {
+                return false;
+            }
+        }
+    }
+    return expected[e] == '\0';
+}
+
+// 음절의 키별 조합 역할이 expected 순서와 같은지 확인
+constexpr bool rolesAre(char32_t syllable, const uint8_t (&expected)[HANGUL_MAX_SYLLABLE_KEYS]) {
+    KeyStroke keys[HANGUL_MAX_SYLLABLE_KEYS] = {};
+    uint8_t roles[HANGUL_MAX_SYLLABLE_KEYS] = {};
+    size_t count = Hangul::syllableKeys(syllable, keys, roles);
+    for (size_t k = 0; k < HANGUL_MAX_SYLLABLE_KEYS; k++) {
+        if ((k < count ? roles[k] : (uint8_t)JAMO_ROLE_NONE) != expected[k]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 모든 음절이 2~5개의 유효한 키로 분해되는지 확인
+constexpr bool allSyllablesTypeable() {
+    for (uint32_t c = HANGUL_SYLLABLE_FIRST; c <= HANGUL_SYLLABLE_LAST; c++) {
+        KeyStroke keys[HANGUL_MAX_SYLLABLE_KEYS] = {};
+        size_t count = Hangul::syllableKeys(c, keys);
+        if (count < 2 || count > HANGUL_MAX_SYLLABLE_KEYS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(sizeof(hangul_detail::CHOSEONG_JAMO) / sizeof(char32_t) - 1 == HANGUL_CHOSEONG_COUNT &&
+              sizeof(hangul_detail::JUNGSEONG_JAMO) / sizeof(char32_t) - 1 == HANGUL_JUNGSEONG_COUNT &&
+              sizeof(hangul_detail::JONGSEONG_JAMO) / sizeof(char32_t) - 1 == HANGUL_JONGSEONG_COUNT,
+              "jamo position tables must match Unicode syllable composition");
+static_assert(allSyllablesTypeable(), "every Hangul syllable must decompose into 2-5 keys");
+
+// 기본 사례
+static_assert(typesAs(U"가", "rk") && typesAs(U"윤", "dbs") && typesAs(U"하늘", "gksmf") &&
+              typesAs(U"되", "ehl") && typesAs(U"돼", "eho") && typesAs(U"맑", "akfr"),
+              "basic syllables");
+
+// 예외 사례 (된소리, 겹모음, 겹받침)
+static_assert(typesAs(U"띄", "Eml") && typesAs(U"넓", "sjfq") && typesAs(U"괜", "rhos") &&
+              typesAs(U"뜨", "Em") && typesAs(U"씨", "Tl"),
+              "edge cases");
+
+// 겹모음과 겹자음 (호환 자모)
+static_assert(typesAs(U"ㅘㅙㅚㅝㅞㅟㅢ", "hkhohlnjnpnlml"), "compound vowels");
+static_assert(typesAs(U"ㄳㄵㄶㄺㄻㄼㄽㄾㄿㅀㅄ", "rtswsgfrfafqftfxfvfgqt"), "compound consonants");
+static_assert(typesAs(U"ㄲㄸㅃㅆㅉ", "REQTW"), "double consonants");
+
+// 단어
+static_assert(typesAs(U"안녕하세요", "dkssudgktpdy") && typesAs(U"사랑해", "tkfkdgo") &&
+              typesAs(U"고마워", "rhakdnj") && typesAs(U"괜찮아", "rhoscksgdk"),
+              "words");
+
+// 예전 시리얼 testko 명령 사례
+static_assert(typesAs(U"가윤", "rkdbs") && typesAs(U"되돼맑", "ehlehoakfr") &&
+              typesAs(U"띄넓", "Emlsjfq"),
+              "legacy testko cases");
+
+// 조합 역할 (초성 / 겹모음 / 겹받침)
+static_assert(rolesAre(U'가', { JAMO_ROLE_CHOSEONG, JAMO_ROLE_JUNGSEONG }) &&
+              rolesAre(U'괜', { JAMO_ROLE_CHOSEONG, JAMO_ROLE_JUNGSEONG, JAMO_ROLE_JUNGSEONG_COMPOUND,
+                                 JAMO_ROLE_JONGSEONG }) &&
+              rolesAre(U'꽯', { JAMO_ROLE_CHOSEONG, JAMO_ROLE_JUNGSEONG, JAMO_ROLE_JUNGSEONG_COMPOUND,
+                                 JAMO_ROLE_JONGSEONG, JAMO_ROLE_JONGSEONG_COMPOUND }),
+              "jamo composition roles");
+
+// 앞 음절 받침으로 먼저 붙는 초성 (가나 → 간, 갈비 → 갋, 각시 → 갃)
+static_assert(Hangul::carriesChoseong(U'가', U'나') && Hangul::carriesChoseong(U'갈', U'비') &&
+              Hangul::carriesChoseong(U'각', U'시') && Hangul::carriesChoseong(U'하', U'씨'),
+              "choseong carried from the previous syllable");
+// 받침이 될 수 없거나 겹받침이 되지 않는 초성 (ㄸ ㅃ ㅉ, 각+ㅇ, 닭+ㅇ)
+static_assert(!Hangul::carriesChoseong(U'가', U'따') && !Hangul::carriesChoseong(U'가', U'짜') &&
+              !Hangul::carriesChoseong(U'각', U'아') && !Hangul::carriesChoseong(U'닭', U'이') &&
+              !Hangul::carriesChoseong(U'갈', U'아'),
+              "choseong that starts a fresh syllable");
+
+} // namespace
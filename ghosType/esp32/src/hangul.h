@@ -0,0 +1,161 @@
+/**
+ * @file hangul.h
+ * @brief 한글 음절 → 두벌식 키 분해
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 완성형 한글 음절(U+AC00~U+D7A3)을 0xAC00 기준 산술로 초성/중성/종성 번호로
+ * 나누고, 위치별 키 표에서 두벌식 키를 찾습니다. 겹모음(ㅘ 등)과 겹받침(ㄺ 등)은
+ * 두 키로 입력됩니다. 키 표는 keymap.h의 자모 표에서 컴파일 시점에 만들어집니다.
+ *
+ * 클라이언트가 한글을 직접 QWERTY로 바꾸지 않고 UTF-8 그대로 보내도
+ * 키 입력 컴파일러가 이 표로 바로 키 이벤트를 만듭니다.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "keymap.h"
+
+// 완성형 한글 음절 범위
+constexpr uint32_t HANGUL_SYLLABLE_FIRST = 0xAC00;
+constexpr uint32_t HANGUL_SYLLABLE_LAST = 0xD7A3;
+
+constexpr size_t HANGUL_CHOSEONG_COUNT = 19;
+constexpr size_t HANGUL_JUNGSEONG_COUNT = 21;
+constexpr size_t HANGUL_JONGSEONG_COUNT = 28;   // 0번은 받침 없음
+
+// 음절 하나를 입력하는 최대 키 수 (초성 1 + 겹모음 2 + 겹받침 2)
+constexpr size_t HANGUL_MAX_SYLLABLE_KEYS = 5;
+
+/**
+ * @brief 자모 키가 음절 조합에서 맡는 역할 (키 사이 간격 조절용)
+ */
+enum JamoRole {
+    JAMO_ROLE_NONE = 0,           ///< 한글 조합과 무관한 키
+    JAMO_ROLE_CHOSEONG,           ///< 초성
+    JAMO_ROLE_CHOSEONG_CARRY,     ///< 앞 음절의 받침으로 먼저 붙었다가 다음 모음에서 넘어오는 초성
+    JAMO_ROLE_JUNGSEONG,          ///< 중성 (겹모음의 첫 키)
+    JAMO_ROLE_JUNGSEONG_COMPOUND, ///< 겹모음의 둘째 키
+    JAMO_ROLE_JONGSEONG,          ///< 종성 (겹받침의 첫 키)
+    JAMO_ROLE_JONGSEONG_COMPOUND, ///< 겹받침의 둘째 키
+    JAMO_ROLE_COUNT
+};
+
+/**
+ * @brief 초성/중성/종성 위치별 키 표 (두 번째 usage 0: 단일 키)
+ */
+struct SyllableKeyTable {
+    KeyStroke choseong[HANGUL_CHOSEONG_COUNT][2];
+    KeyStroke jungseong[HANGUL_JUNGSEONG_COUNT][2];
+    KeyStroke jongseong[HANGUL_JONGSEONG_COUNT][2];
+};
+
+namespace hangul_detail {
+
+// 위치별 자모 (유니코드 음절 번호 순서, 호환 자모로 표기)
+constexpr char32_t CHOSEONG_JAMO[] = U"ㄱㄲㄴㄷㄸㄹㅁㅂㅃㅅㅆㅇㅈㅉㅊㅋㅌㅍㅎ";
+constexpr char32_t JUNGSEONG_JAMO[] = U"ㅏㅐㅑㅒㅓㅔㅕㅖㅗㅘㅙㅚㅛㅜㅝㅞㅟㅠㅡㅢㅣ";
+constexpr char32_t JONGSEONG_JAMO[] = U"\0ㄱㄲㄳㄴㄵㄶㄷㄹㄺㄻㄼㄽㄾㄿㅀㅁㅂㅄㅅㅆㅇㅈㅊㅋㅌㅍㅎ";
+
+constexpr void copyJamo(KeyStroke (&dst)[2], char32_t jamo) {
+    if (jamo != 0) {
+        dst[0] = HANGUL_JAMO_KEYS.keys[jamo - HANGUL_JAMO_FIRST][0];
+        dst[1] = HANGUL_JAMO_KEYS.keys[jamo - HANGUL_JAMO_FIRST][1];
+    }
+}
+
+constexpr SyllableKeyTable buildSyllableKeys() {
+    SyllableKeyTable table = {};
+    for (size_t i = 0; i < HANGUL_CHOSEONG_COUNT; i++) {
+        copyJamo(table.choseong[i], CHOSEONG_JAMO[i]);
+    }
+    for (size_t i = 0; i < HANGUL_JUNGSEONG_COUNT; i++) {
+        copyJamo(table.jungseong[i], JUNGSEONG_JAMO[i]);
+    }
+    for (size_t i = 0; i < HANGUL_JONGSEONG_COUNT; i++) {
+        copyJamo(table.jongseong[i], JONGSEONG_JAMO[i]);
+    }
+    return table;
+}
+
+} // namespace hangul_detail
+
+inline constexpr SyllableKeyTable HANGUL_SYLLABLE_KEYS = hangul_detail::buildSyllableKeys();
+
+/**
+ * @brief 한글 분해 유틸리티 클래스
+ */
+class Hangul {
+public:
+    static constexpr bool isSyllable(uint32_t code_point) {
+        return code_point >= HANGUL_SYLLABLE_FIRST && code_point <= HANGUL_SYLLABLE_LAST;
+    }
+
+    static constexpr bool isJamo(uint32_t code_point) {
+        return code_point - HANGUL_JAMO_FIRST < HANGUL_JAMO_COUNT;
+    }
+
+    /**
+     * @brief 음절을 두벌식 키 열로 분해
+     * @param code_point 완성형 음절 (isSyllable이 참이어야 함)
+     * @param[out] keys 키 열 (HANGUL_MAX_SYLLABLE_KEYS개 이상)
+     * @param[out] roles 키별 JamoRole (NULL이면 생략, 초성은 항상 JAMO_ROLE_CHOSEONG)
+     * @return 키 수 (2~5)
+     */
+    static constexpr size_t syllableKeys(uint32_t code_point, KeyStroke* keys, uint8_t* roles = nullptr) {
+        uint32_t index = code_point - HANGUL_SYLLABLE_FIRST;
+        const KeyStroke* parts[3] = {
+            HANGUL_SYLLABLE_KEYS.choseong[index / (HANGUL_JUNGSEONG_COUNT * HANGUL_JONGSEONG_COUNT)],
+            HANGUL_SYLLABLE_KEYS.jungseong[(index / HANGUL_JONGSEONG_COUNT) % HANGUL_JUNGSEONG_COUNT],
+            HANGUL_SYLLABLE_KEYS.jongseong[index % HANGUL_JONGSEONG_COUNT]
+        };
+        // 위치별 [첫 키, 둘째 키] 역할
+        const uint8_t part_roles[3][2] = {
+            { JAMO_ROLE_CHOSEONG, JAMO_ROLE_CHOSEONG },
+            { JAMO_ROLE_JUNGSEONG, JAMO_ROLE_JUNGSEONG_COMPOUND },
+            { JAMO_ROLE_JONGSEONG, JAMO_ROLE_JONGSEONG_COMPOUND }
+        };
+
+        size_t count = 0;
+        for (size_t p = 0; p < 3; p++) {
+            for (size_t k = 0; k < 2 && parts[p][k].usage != 0; k++) {
+                if (roles) {
+                    roles[count] = part_roles[p][k];
+                }
+                keys[count++] = parts[p][k];
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief 음절의 초성이 IME에서 앞 음절의 받침으로 먼저 붙는지 판단
+     * @param previous 바로 앞에 입력한 완성형 음절
+     * @param code_point 이번 완성형 음절
+     * @return true 초성 키가 앞 음절의 받침(또는 겹받침의 둘째 키)으로 조합되었다가
+     *         이번 음절의 모음 키에서 다음 음절로 옮겨짐 (예: 가나 → 간 → 가나)
+     */
+    static constexpr bool carriesChoseong(uint32_t previous, uint32_t code_point) {
+        uint32_t prev_index = previous - HANGUL_SYLLABLE_FIRST;
+        const KeyStroke* prev_jong = HANGUL_SYLLABLE_KEYS.jongseong[prev_index % HANGUL_JONGSEONG_COUNT];
+        const KeyStroke* cho = HANGUL_SYLLABLE_KEYS.choseong[
+            (code_point - HANGUL_SYLLABLE_FIRST) / (HANGUL_JUNGSEONG_COUNT * HANGUL_JONGSEONG_COUNT)];
+
+        if (prev_jong[1].usage != 0) {
+            return false;  // 이미 겹받침 - 더 붙을 자리가 없음
+        }
+        // 받침 없음: 초성 키 하나가 받침이 되는지 / 홑받침: 두 키가 겹받침이 되는지
+        KeyStroke first = prev_jong[0].usage != 0 ? prev_jong[0] : cho[0];
+        KeyStroke second = prev_jong[0].usage != 0 ? cho[0] : KeyStroke{ 0, 0 };
+        for (size_t j = 1; j < HANGUL_JONGSEONG_COUNT; j++) {
+            const KeyStroke* jong = HANGUL_SYLLABLE_KEYS.jongseong[j];
+            if (jong[0].usage == first.usage && jong[0].modifiers == first.modifiers &&
+                jong[1].usage == second.usage && jong[1].modifiers == second.modifiers) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
@@ -0,0 +1,143 @@
+/**
+ * @file Arduino.h
+ * @brief 호스트 빌드용 Arduino API 대체 구현
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 펌웨어 소스가 쓰는 만큼만 제공합니다 (String, 시간 함수, ESP, PSRAM 할당).
+ * 기기 빌드에서는 build_src_filter로 host/ 디렉터리 전체가 빠집니다.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "freertos/FreeRTOS.h"
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+/**
+ * @brief Arduino String 대체 (std::string 기반)
+ *
+ * ArduinoJson의 Arduino String 지원(ARDUINOJSON_ENABLE_ARDUINO_STRING)이 요구하는
+ * c_str(), length(), concat(const char*), const char* 대입도 포함합니다.
+ */
+class String {
+public:
+    String() {}
+    String(const char* text) : value(text ? text : "") {}
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : value(1, c) {}
+    explicit String(int number) : value(std::to_string(number)) {}
+    explicit String(unsigned int number) : value(std::to_string(number)) {}
+    explicit String(long number) : value(std::to_string(number)) {}
+    explicit String(unsigned long number) : value(std::to_string(number)) {}
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* text) {
+        value = text ? text : "";
+        return *this;
+    }
+
+    unsigned int length() const { return (unsigned int)value.size(); }
+    const char* c_str() const { return value.c_str(); }
+    bool reserve(unsigned int size) { value.reserve(size); return true; }
+
+    bool concat(const char* text) { value += text ? text : ""; return true; }
+    bool concat(const char* text, unsigned int length) { value.append(text, length); return true; }
+    bool concat(const String& other) { value += other.value; return true; }
+    bool concat(char c) { value += c; return true; }
+
+    String& operator+=(const String& other) { value += other.value; return *this; }
+    String& operator+=(const char* text) { return concat(text), *this; }
+    String& operator+=(char c) { value += c; return *this; }
+    String& operator+=(int number) { value += std::to_string(number); return *this; }
+    String& operator+=(unsigned int number) { value += std::to_string(number); return *this; }
+    String& operator+=(long number) { value += std::to_string(number); return *this; }
+    String& operator+=(unsigned long number) { value += std::to_string(number); return *this; }
+
+    bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    String substring(unsigned int from) const {
+        return from < value.size() ? String(value.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        return from < value.size() && from < to ? String(value.substr(from, to - from)) : String();
+    }
+    long toInt() const { return atol(value.c_str()); }
+
+    char operator[](unsigned int index) const { return index < value.size() ? value[index] : 0; }
+    bool operator==(const String& other) const { return value == other.value; }
+    bool operator==(const char* text) const { return value == (text ? text : ""); }
+    bool operator!=(const String& other) const { return value != other.value; }
+
+private:
+    explicit String(const std::string& text) : value(text) {}
+    friend String operator+(const String& a, const String& b);
+
+    std::string value;
+};
+
+inline String operator+(const String& a, const String& b) { return String(a.value + b.value); }
+inline String operator+(const String& a, const char* b) { return a + String(b); }
+inline String operator+(const char* a, const String& b) { return String(a) + b; }
+
+// ArduinoJson의 문자열 어댑터가 이름으로 참조
+class StringSumHelper : public String {
+public:
+    using String::String;
+};
+
+/**
+ * @brief 디버그 출력 (표준 오류)
+ */
+class HostSerial {
+public:
+    void begin(unsigned long baud) {}
+    template <typename T> void print(const T& value) { fputs(String(value).c_str(), stderr); }
+    template <typename T> void println(const T& value) { print(value); fputc('\n', stderr); }
+};
+extern HostSerial Serial;
+
+/**
+ * @brief 칩 정보 (호스트에서는 의미 없는 값)
+ */
+class HostEsp {
+public:
+    uint32_t getFreeHeap() { return 0; }
+};
+extern HostEsp ESP;
+
+inline bool psramFound() { return false; }
+
+/**
+ * @brief 리셋 원인 (ESP-IDF esp_reset_reason_t와 같은 값, 호스트에서는 항상 전원 투입)
+ */
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO,
+} esp_reset_reason_t;
+
+inline esp_reset_reason_t esp_reset_reason() { return ESP_RST_POWERON; }
+
+/**
+ * @brief 하드웨어 난수 대체 (호스트에서는 재생 결과가 같도록 시드 없는 rand())
+ */
+inline uint32_t esp_random() { return ((uint32_t)rand() << 16) ^ (uint32_t)rand(); }
@@ -0,0 +1,43 @@
+/**
+ * @file USB.h
+ * @brief 호스트 빌드용 USB 스택 대체 (시작하면 바로 열거된 것으로 봄)
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+typedef const char* esp_event_base_t;
+typedef void (*esp_event_handler_t)(void* arg, esp_event_base_t base, int32_t id, void* data);
+
+enum arduino_usb_event_t {
+    ARDUINO_USB_ANY_EVENT = -1,
+    ARDUINO_USB_STARTED_EVENT = 0,
+    ARDUINO_USB_STOPPED_EVENT,
+    ARDUINO_USB_SUSPEND_EVENT,
+    ARDUINO_USB_RESUME_EVENT
+};
+
+class HostUsb {
+public:
+    HostUsb() : started_handler(NULL) {}
+
+    /** @brief 시작 즉시 열거된 것으로 보고 ARDUINO_USB_STARTED_EVENT 전달 */
+    void begin() {
+        if (started_handler) {
+            started_handler(NULL, "ARDUINO_USB_EVENTS", ARDUINO_USB_STARTED_EVENT, NULL);
+        }
+    }
+
+    void onEvent(arduino_usb_event_t event, esp_event_handler_t callback) {
+        if (event == ARDUINO_USB_STARTED_EVENT) {
+            started_handler = callback;
+        }
+    }
+
+private:
+    esp_event_handler_t started_handler;
+};
+extern HostUsb USB;
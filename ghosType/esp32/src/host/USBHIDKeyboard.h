@@ -0,0 +1,58 @@
+/**
+ * @file USBHIDKeyboard.h
+ * @brief 호스트 빌드용 HID 키보드 대체 구현
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 리포트를 보내는 대신 개수를 세고, 옵션을 주면 리포트마다 한 줄씩 기록합니다.
+ * 기록 형식: <마이크로초> <수정키 hex> <키 hex> (키를 모두 뗀 리포트는 키 00)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "USB.h"
+
+// Arduino USBHIDKeyboard와 같은 특수 키 코드 (0x80 이상: 수정키/특수 키)
+#define KEY_LEFT_CTRL 0x80
+#define KEY_LEFT_SHIFT 0x81
+#define KEY_LEFT_ALT 0x82
+#define KEY_RIGHT_ALT 0x86
+#define KEY_RETURN 0xB0
+#define KEY_BACKSPACE 0xB2
+#define KEY_TAB 0xB3
+
+typedef struct {
+    uint8_t modifiers;
+    uint8_t reserved;
+    uint8_t keys[6];
+} KeyReport;
+
+enum arduino_usb_hid_keyboard_event_t {
+    ARDUINO_USB_HID_KEYBOARD_ANY_EVENT = -1,
+    ARDUINO_USB_HID_KEYBOARD_LED_EVENT = 0
+};
+
+typedef struct {
+    uint8_t leds;
+} arduino_usb_hid_keyboard_event_data_t;
+
+class USBHIDKeyboard {
+public:
+    USBHIDKeyboard();
+
+    void begin() {}
+    void onEvent(arduino_usb_hid_keyboard_event_t event, esp_event_handler_t callback) {}
+
+    size_t press(uint8_t key);
+    size_t release(uint8_t key);
+    void sendReport(KeyReport* report);
+
+    uint32_t reports() const { return report_count; }
+
+private:
+    void record(const KeyReport& report);
+
+    KeyReport current;
+    uint32_t report_count;
+};
@@ -0,0 +1,15 @@
+/**
+ * @file esp_timer.h
+ * @brief 호스트 빌드용 ESP-IDF 고해상도 타이머 대체 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief 시작 후 경과 시간 (마이크로초, 가상 시계에서는 건너뛴 delay() 포함 - micros()와 같은 기준)
+ */
+int64_t esp_timer_get_time();
@@ -0,0 +1,104 @@
+/**
+ * @file host_arduino.cpp
+ * @brief 호스트 빌드용 Arduino/USB/ROM 대체 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include <Arduino.h>
+#include <USB.h>
+#include <USBHIDKeyboard.h>
+#include <rom/crc.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "host_options.h"
+
+HostOptions hostOptions = { HOST_DEFAULT_SOCKET_PATH, false, false, NULL, NULL, NULL, NULL, NULL, -1 };
+HostSerial Serial;
+HostEsp ESP;
+HostUsb USB;
+
+static const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
+// 가상 시계에서 건너뛴 delay() 합계 - 실제 경과 시간에 더해 millis()/micros()로 보임
+static std::atomic<uint64_t> skipped_us(0);
+
+static uint64_t elapsedUs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - started).count() + skipped_us.load();
+}
+
+unsigned long millis() {
+    return (unsigned long)(elapsedUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)elapsedUs();
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)elapsedUs();
+}
+
+void delay(uint32_t ms) {
+    delayMicroseconds(ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+    if (hostOptions.virtual_clock) {
+        skipped_us += us;
+    } else if (!hostOptions.no_delay) {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+    }
+}
+
+uint32_t crc32_le(uint32_t crc, const uint8_t* buffer, uint32_t length) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= buffer[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+USBHIDKeyboard::USBHIDKeyboard() : current(), report_count(0) {
+}
+
+size_t USBHIDKeyboard::press(uint8_t key) {
+    // Arduino 키 코드: 0x80~0x87 수정키, 0x88 이상은 HID 사용 코드 + 0x88
+    if (key >= 0x80 && key < 0x88) {
+        current.modifiers |= (uint8_t)(1 << (key - 0x80));
+    } else if (key >= 0x88) {
+        current.keys[0] = (uint8_t)(key - 0x88);
+    }
+    record(current);
+    return 1;
+}
+
+size_t USBHIDKeyboard::release(uint8_t key) {
+    if (key >= 0x80 && key < 0x88) {
+        current.modifiers &= (uint8_t)~(1 << (key - 0x80));
+    } else if (key >= 0x88 && current.keys[0] == key - 0x88) {
+        current.keys[0] = 0;
+    }
+    record(current);
+    return 1;
+}
+
+void USBHIDKeyboard::sendReport(KeyReport* report) {
+    current = *report;
+    record(current);
+}
+
+void USBHIDKeyboard::record(const KeyReport& report) {
+    report_count++;
+    if (hostOptions.hid_report) {
+        hostOptions.hid_report(report.modifiers, report.keys[0]);
+    }
+    if (hostOptions.hid_trace) {
+        fprintf(hostOptions.hid_trace, "%lu %02x %02x\n", micros(), report.modifiers, report.keys[0]);
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file host_freertos.cpp
+ * @brief 호스트 빌드용 FreeRTOS API 대체 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "freertos/FreeRTOS.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string.h>
+
+struct HostTask {
+    std::mutex lock;
+    std::condition_variable signal;
+    uint32_t notifications = 0;
+};
+
+struct HostMutex {
+    std::timed_mutex lock;
+};
+
+struct HostQueue {
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t item_size;
+};
+
+// 현재 스레드의 태스크 (setup()/loop()를 실행하는 주 스레드는 처음 쓸 때 생성)
+static thread_local HostTask* current_task = NULL;
+
+static HostTask* currentTask() {
+    if (!current_task) {
+        current_task = new HostTask();
+    }
+    return current_task;
+}
+
+// 조건이 참이 되거나 ticks가 지날 때까지 대기 (portMAX_DELAY: 무한)
+template <typename Predicate>
+static bool waitFor(std::condition_variable& signal, std::unique_lock<std::mutex>& guard,
+                    TickType_t ticks, Predicate ready) {
+    if (ticks == portMAX_DELAY) {
+        signal.wait(guard, ready);
+        return true;
+    }
+    return signal.wait_for(guard, std::chrono::milliseconds(ticks), ready);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack_depth,
+                                   void* parameter, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core) {
+    HostTask* task = new HostTask();
+    if (handle) {
+        *handle = task;
+    }
+    std::thread([function, parameter, task]() {
+        current_task = task;
+        function(parameter);
+    }).detach();
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        task->notifications++;
+    }
+    task->signal.notify_one();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    HostTask* task = currentTask();
+    std::unique_lock<std::mutex> guard(task->lock);
+    waitFor(task->signal, guard, ticks, [task]() { return task->notifications > 0; });
+    uint32_t value = task->notifications;
+    if (value > 0) {
+        task->notifications = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new HostMutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks) {
+    if (ticks == portMAX_DELAY) {
+        mutex->lock.lock();
+        return pdTRUE;
+    }
+    return mutex->lock.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+    mutex->lock.unlock();
+    return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> guard(queue->lock);
+    if (!waitFor(queue->changed, guard, ticks, [queue]() { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    guard.unlock();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> guard(queue->lock);
+    if (!waitFor(queue->changed, guard, ticks, [queue]() { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    guard.unlock();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return (UBaseType_t)queue->items.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return (UBaseType_t)(queue->length - queue->items.size());
+}
@@ -0,0 +1,74 @@
+/**
+ * @file host_main.cpp
+ * @brief 호스트 빌드 진입점 - 펌웨어의 setup()/loop()를 리눅스 프로세스로 실행
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 사용법: program [--socket 경로] [--no-delay | --virtual-clock] [--hid-trace 파일]
+ *         program --replay 스크립트 [--golden 기준] [--record 결과] [--hid-trace 파일]
+ *   --socket         수신 소켓 경로 (기본 /tmp/ghostype.sock)
+ *   --no-delay       타이핑 간격을 건너뛰어 프로토콜 처리량만 측정
+ *   --virtual-clock  타이핑 간격을 건너뛰되 그만큼 시계를 앞당김 (시간 통계는 실제 장치와 같은 기준)
+ *   --hid-trace      HID 리포트를 한 줄씩 기록 ("-": 표준 출력)
+ *   --replay         소켓 대신 스크립트를 재생하고 종료 (가상 시계 사용, replay_transport.h 참고)
+ *   --golden         재생 결과를 기준 트레이스와 비교 - 다르면 종료 코드 1
+ *   --record         재생 결과 트레이스를 파일로 저장 (기준 트레이스 갱신용)
+ */
+
+#include <Arduino.h>
+#include <signal.h>
+#include <unistd.h>
+#include "host_options.h"
+
+void setup();
+void loop();
+
+// native 테스트(pio test -e native)는 펌웨어 소스를 함께 빌드하고 자체 main()을 씀
+#ifndef PIO_UNIT_TESTING
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+            hostOptions.socket_path = argv[++i];
+        } else if (strcmp(argv[i], "--no-delay") == 0) {
+            hostOptions.no_delay = true;
+        } else if (strcmp(argv[i], "--virtual-clock") == 0) {
+            hostOptions.virtual_clock = true;
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            hostOptions.replay_path = argv[++i];
+        } else if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc) {
+            hostOptions.golden_path = argv[++i];
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            hostOptions.record_path = argv[++i];
+        } else if (strcmp(argv[i], "--hid-trace") == 0 && i + 1 < argc) {
+            const char* path = argv[++i];
+            hostOptions.hid_trace = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+            if (!hostOptions.hid_trace) {
+                perror(path);
+                return 1;
+            }
+            setvbuf(hostOptions.hid_trace, NULL, _IOLBF, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--socket path] [--no-delay | --virtual-clock] [--hid-trace file|-]\n"
+                            "       %s --replay script [--golden trace] [--record trace]\n", argv[0], argv[0]);
+            return 2;
+        }
+    }
+    if (hostOptions.replay_path) {
+        // 재생은 소켓을 열지 않고, 작업 시간 예산은 가상 시계 기준
+        hostOptions.socket_path = NULL;
+        hostOptions.virtual_clock = true;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    setup();
+    if (hostOptions.socket_path) {
+        fprintf(stderr, "listening on %s\n", hostOptions.socket_path);
+    }
+    while (hostOptions.replay_result < 0) {
+        loop();
+    }
+    fflush(stdout);
+    fflush(stderr);
+    _exit(hostOptions.replay_result);  // 태스크가 도는 중이므로 정적 소멸자를 거치지 않고 종료
+}
+#endif
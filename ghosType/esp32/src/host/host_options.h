@@ -0,0 +1,33 @@
+/**
+ * @file host_options.h
+ * @brief 호스트 빌드 실행 옵션
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 호스트 빌드(env:native)는 펌웨어의 수신/컴파일/타이핑 로직을 그대로 리눅스 프로세스로 실행합니다.
+ * 무선 대신 유닉스 도메인 소켓(또는 재생 스크립트)으로 메시지를 받고, HID 리포트는 기록만 합니다.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define HOST_DEFAULT_SOCKET_PATH "/tmp/ghostype.sock"
+
+/**
+ * @brief 명령행에서 정하는 호스트 실행 옵션 (host_main.cpp에서 setup() 전에 채움)
+ */
+struct HostOptions {
+    const char* socket_path;   ///< 수신 소켓 경로
+    bool no_delay;             ///< delay()를 건너뜀 - 타이핑 속도 제약 없이 프로토콜 처리량만 측정
+    bool virtual_clock;        ///< delay()를 건너뛰되 그만큼 millis()/micros()를 앞당김
+    FILE* hid_trace;           ///< HID 리포트 기록 파일 (NULL: 기록 안 함)
+    const char* replay_path;   ///< 재생할 스크립트 (NULL: 소켓으로 수신)
+    const char* golden_path;   ///< 재생 결과와 비교할 기준 트레이스
+    const char* record_path;   ///< 재생 결과 트레이스를 저장할 파일
+    void (*hid_report)(uint8_t modifiers, uint8_t key);  ///< HID 리포트마다 호출 (재생 경로가 등록)
+    volatile int replay_result;  ///< 재생 종료 코드 (-1: 재생 중이거나 재생 안 함) - loop()를 돌리는 쪽이 보고 종료
+};
+
+extern HostOptions hostOptions;
@@ -0,0 +1,48 @@
+/**
+ * @file host_snippet_store.cpp
+ * @brief 호스트 빌드용 스니펫 저장소 (메모리, 프로세스 종료 시 사라짐)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * NVS/SPIFFS 대신 맵에 보관합니다. 크기 제한은 기기와 같습니다.
+ */
+
+#include "../snippet_store.h"
+#include <map>
+#include <mutex>
+
+static std::map<uint16_t, std::vector<KeyEvent>> snippets;
+static std::mutex snippets_lock;
+
+bool SnippetStore::initialized = false;
+bool SnippetStore::spiffs_mounted = false;
+
+bool SnippetStore::initialize() {
+    initialized = true;
+    return true;
+}
+
+bool SnippetStore::save(uint16_t id, const std::vector<KeyEvent>& events) {
+    if (!initialized || events.empty() ||
+        sizeof(SnippetHeader) + events.size() * sizeof(KeyEvent) > SNIPPET_MAX_BYTES) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(snippets_lock);
+    snippets[id] = events;
+    return true;
+}
+
+bool SnippetStore::load(uint16_t id, std::vector<KeyEvent>& events) {
+    std::lock_guard<std::mutex> guard(snippets_lock);
+    auto found = snippets.find(id);
+    if (found == snippets.end()) {
+        return false;
+    }
+    events = found->second;
+    return true;
+}
+
+bool SnippetStore::remove(uint16_t id) {
+    std::lock_guard<std::mutex> guard(snippets_lock);
+    return snippets.erase(id) > 0;
+}
@@ -0,0 +1,291 @@
+/**
+ * @file replay_transport.cpp
+ * @brief 호스트 빌드용 스크립트 재생 수신 경로 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "replay_transport.h"
+#include <ctype.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include "host_options.h"
+
+// 큐에 들어간 작업이 끝나기를 기다리는 최대 실제 시간 (넘으면 멈춘 것으로 보고 실패)
+#define REPLAY_JOB_TIMEOUT_MS 60000
+// 작업이 아닌 메시지의 첫 응답을 기다리는 실제 시간 (응답 없는 메시지 포함)
+#define REPLAY_REPLY_WAIT_MS 500
+// 구간이 끝난 뒤 늦게 오는 응답/리포트를 모으는 실제 시간
+#define REPLAY_SETTLE_MS 50
+
+ReplayTransport* ReplayTransport::instance = NULL;
+
+ReplayTransport::ReplayTransport(const char* transport_name, ReplayTransport* primary)
+    : transport_name(transport_name), primary(primary), secondary(NULL), running(false), queued(0), finished(0),
+      last_reply_ms(0) {
+    if (primary) {
+        primary->secondary = this;
+    }
+}
+
+bool ReplayTransport::begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) {
+    if (!hostOptions.replay_path) {
+        return false;
+    }
+    receive_handler = on_receive;
+    connection_handler = on_connection;
+    if (primary) {
+        running = true;  // 재생 태스크가 기다렸다가 연결 알림과 함께 시작
+        return true;
+    }
+    if (!load(hostOptions.replay_path)) {
+        hostOptions.replay_result = 2;
+        return false;
+    }
+    instance = this;
+    hostOptions.hid_report = onHidReport;
+    running = true;
+    return xTaskCreatePinnedToCore(replayTask, "Replay_Task", 0, this, 1, NULL, 0) == pdPASS;
+}
+
+bool ReplayTransport::load(const char* path) {
+    std::ifstream file(path);
+    if (!file) {
+        perror(path);
+        return false;
+    }
+    std::string line;
+    uint32_t budget = 0;
+    for (int number = 1; std::getline(file, line); number++) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        if (line.compare(0, 8, "@budget ") == 0) {
+            budget = (uint32_t)atol(line.c_str() + 8);
+            continue;
+        }
+        bool second = line.compare(0, 1, "2") == 0;
+        size_t at = second ? 1 : 0;
+        bool wait = line.compare(at, 2, "> ") == 0;
+        if (!wait && line.compare(at, 3, ">> ") != 0) {
+            fprintf(stderr, "%s:%d: expected '> ', '>> ', '2> ', '2>> ' or '@budget'\n", path, number);
+            return false;
+        }
+        if (second && !secondary) {
+            fprintf(stderr, "%s:%d: no second replay client\n", path, number);
+            return false;
+        }
+        Step step = { std::string(), wait, second, budget, number };
+        if (!unescape(line.substr(at + (wait ? 2 : 3)), step.message) || step.message.empty()) {
+            fprintf(stderr, "%s:%d: bad \\x escape or empty message\n", path, number);
+            return false;
+        }
+        steps.push_back(step);
+        if (wait) {
+            budget = 0;  // 예산은 다음 구간 하나에만 적용
+        }
+    }
+    return true;
+}
+
+bool ReplayTransport::unescape(const std::string& text, std::string& out) {
+    // \xHH만 이스케이프 - JSON의 \n, \" 등은 그대로 전달
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\\' && i + 1 < text.size() && text[i + 1] == 'x') {
+            if (i + 3 >= text.size() || !isxdigit((unsigned char)text[i + 2]) ||
+                !isxdigit((unsigned char)text[i + 3])) {
+                return false;
+            }
+            out += (char)strtol(text.substr(i + 2, 2).c_str(), NULL, 16);
+            i += 3;
+        } else {
+            out += text[i];
+        }
+    }
+    return true;
+}
+
+std::string ReplayTransport::escape(const std::string& message) {
+    std::string out;
+    char hex[5];
+    for (size_t i = 0; i < message.size(); i++) {
+        uint8_t c = (uint8_t)message[i];
+        bool literal_escape = c == '\\' && i + 1 < message.size() && message[i + 1] == 'x';
+        if (c < 0x20 || c == 0x7F || c >= 0xF8 || literal_escape) {
+            snprintf(hex, sizeof(hex), "\\x%02X", c);
+            out += hex;
+        } else {
+            out += (char)c;
+        }
+    }
+    return out;
+}
+
+bool ReplayTransport::isJobReply(const std::string& text) {
+    // 타이핑 없이 끝난 벌크 작업은 완료 응답 대신 이 응답 하나로 끝남
+    static const char* const replies[] = {
+        "OK:SNP:", "ERR:SNIPPET_NOT_FOUND", "ERR:SNIPPET_STORE", "ERR:CACHE_EVICTED", "ERR:INVALID_DATA"
+    };
+    for (const char* reply : replies) {
+        if (text.compare(0, strlen(reply), reply) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ReplayTransport::notify(const String& message) {
+    if (primary) {
+        primary->record(message, true);
+    } else {
+        record(message, false);
+    }
+}
+
+void ReplayTransport::record(const String& message, bool second) {
+    std::lock_guard<std::mutex> guard(lock);
+    std::string text(message.c_str(), message.length());
+    if (text.compare(0, 4, "PRG:") == 0) {
+        return;  // 진행 알림은 시각에 따라 달라짐
+    }
+    if (text.compare(0, 4, "STS:") == 0) {
+        text = "STS";
+    }
+    if (text == "OK:Queued for typing") {
+        queued++;
+    } else if (text == "OK:Typing completed" || text == "ERR:STREAM_TIMEOUT" || text.compare(0, 4, "ACK:") == 0 ||
+               text.compare(0, 5, "NACK:") == 0 || isJobReply(text)) {
+        finished++;
+    }
+    replies.push_back((second ? "2< " : "< ") + text);
+    last_reply_ms = millis();
+    changed.notify_all();
+}
+
+void ReplayTransport::onHidReport(uint8_t modifiers, uint8_t key) {
+    char line[8];
+    snprintf(line, sizeof(line), "%02x %02x", modifiers, key);
+    std::lock_guard<std::mutex> guard(instance->lock);
+    instance->reports.push_back(line);
+    instance->changed.notify_all();
+}
+
+void ReplayTransport::replayTask(void* parameter) {
+    ReplayTransport* self = (ReplayTransport*)parameter;
+    if (self->secondary) {
+        while (!self->secondary->running) {
+            delay(1);  // setup()이 두 번째 클라이언트를 등록할 때까지
+        }
+        self->secondary->connectionChanged(true);
+    }
+    self->connectionChanged(true);
+    // loop()를 돌리는 쪽(host_main 또는 native 테스트)이 결과를 보고 종료
+    hostOptions.replay_result = self->run();
+}
+
+int ReplayTransport::run() {
+    using namespace std::chrono;
+    std::ostringstream result;
+    int failures = 0;
+    size_t i = 0;
+
+    while (i < steps.size()) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            replies.clear();
+            reports.clear();
+            queued = 0;
+            finished = 0;
+        }
+
+        // 구간: 기다리는 단계(>)까지 보냄
+        int line = steps[i].line;
+        uint32_t budget = 0;
+        uint32_t started = millis();
+        while (i < steps.size()) {
+            const Step& step = steps[i++];
+            budget = step.budget_ms ? step.budget_ms : budget;
+            result << (step.second ? "2> " : "> ") << escape(step.message) << "\n";
+            if (step.message.compare(0, 2, "\xFF\x03") == 0) {
+                // 청크 작업은 대기 응답 없이 ACK/NACK로 끝남 - 번갈아 보낸 청크가 모두 끝날 때까지 기다림
+                std::lock_guard<std::mutex> guard(lock);
+                queued++;
+            }
+            (step.second ? secondary : this)->deliver((const uint8_t*)step.message.data(), step.message.size());
+            if (step.wait) {
+                break;
+            }
+        }
+
+        std::unique_lock<std::mutex> guard(lock);
+        bool stuck = false;
+        if (queued > 0) {
+            stuck = !changed.wait_for(guard, milliseconds(REPLAY_JOB_TIMEOUT_MS),
+                                      [this] { return finished >= queued; });
+        } else {
+            changed.wait_for(guard, milliseconds(REPLAY_REPLY_WAIT_MS), [this] { return !replies.empty(); });
+        }
+        uint32_t elapsed = replies.empty() ? 0 : last_reply_ms - started;
+        size_t seen = replies.size() + reports.size();
+        while (changed.wait_for(guard, milliseconds(REPLAY_SETTLE_MS),
+                                [&] { return replies.size() + reports.size() != seen; })) {
+            seen = replies.size() + reports.size();
+        }
+
+        for (const std::string& reply : replies) {
+            result << reply << "\n";
+        }
+        for (const std::string& report : reports) {
+            result << "= " << report << "\n";
+        }
+        result << "\n";
+
+        bool over = budget > 0 && elapsed > budget;
+        fprintf(stderr, "%s:%d: %lu ms", hostOptions.replay_path, line, (unsigned long)elapsed);
+        if (budget > 0) {
+            fprintf(stderr, " (budget %lu ms)", (unsigned long)budget);
+        }
+        fprintf(stderr, "%s\n", stuck ? " STUCK" : over ? " OVER BUDGET" : "");
+        failures += stuck || over ? 1 : 0;
+    }
+
+    std::string trace = result.str();
+    if (hostOptions.record_path) {
+        std::ofstream(hostOptions.record_path) << trace;
+    }
+    if (hostOptions.golden_path) {
+        failures += compareGolden(trace) ? 0 : 1;
+    }
+    if (!hostOptions.record_path && !hostOptions.golden_path) {
+        fputs(trace.c_str(), stdout);
+    }
+    fprintf(stderr, "replay: %zu steps, %d failure(s)\n", steps.size(), failures);
+    return failures ? 1 : 0;
+}
+
+bool ReplayTransport::compareGolden(const std::string& result) const {
+    std::ifstream file(hostOptions.golden_path);
+    if (!file) {
+        perror(hostOptions.golden_path);
+        return false;
+    }
+    std::istringstream actual(result);
+    std::string expected_line;
+    std::string actual_line;
+    for (int number = 1; ; number++) {
+        bool has_expected = (bool)std::getline(file, expected_line);
+        bool has_actual = (bool)std::getline(actual, actual_line);
+        if (!has_expected && !has_actual) {
+            return true;
+        }
+        if (has_expected != has_actual || expected_line != actual_line) {
+            fprintf(stderr, "%s:%d: trace differs\n  expected: %s\n  actual:   %s\n", hostOptions.golden_path,
+                    number, has_expected ? expected_line.c_str() : "(end)", has_actual ? actual_line.c_str() : "(end)");
+            return false;
+        }
+    }
+}
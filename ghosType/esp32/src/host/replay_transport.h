@@ -0,0 +1,109 @@
+/**
+ * @file replay_transport.h
+ * @brief 호스트 빌드용 스크립트 재생 수신 경로 (HID 리포트 기록 비교, 작업별 시간 예산)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 스크립트의 메시지를 차례로 넣고, 응답과 HID 리포트 열을 모아 결과 트레이스를 만듭니다.
+ * 기준(골든) 트레이스와 한 줄이라도 다르거나 작업이 시간 예산을 넘으면 실패로 끝나므로
+ * Enter/한영 전환/JSON 해석 실패 시 원문 입력 같은 동작 변화와 속도 저하를 같은 방식으로 잡습니다.
+ * 시간은 가상 시계(delay()를 건너뛰고 그만큼 millis()를 앞당김) 기준이라 실제로 기다리지 않습니다.
+ *
+ * 스크립트 (한 줄에 하나, 빈 줄과 #으로 시작하는 줄은 무시):
+ *   > 메시지     보내고 끝날 때까지 기다림 (큐에 들어간 작업은 완료 응답, 아니면 첫 응답)
+ *   >> 메시지    보내고 기다리지 않음 (스트림 시작/연속 프레임 등 - 다음 >까지 한 구간)
+ *   @budget ms   이번 구간의 가상 시간 예산 (첫 전송부터 마지막 완료까지)
+ *   2> / 2>>     두 번째 재생 클라이언트(replay2)가 보냄 - 클라이언트별 상태와 응답 대상 확인용
+ * 메시지 안에서는 \n \t \\ \xHH 이스케이프를 씁니다 (바이너리 프레임은 \xFF\x09...).
+ *
+ * 결과 트레이스는 구간마다 보낸 메시지(>), 응답(<), HID 리포트(= 수정키 키)를 차례로 적습니다.
+ * 두 번째 클라이언트가 보낸 메시지와 받은 응답은 2>, 2<로 적습니다.
+ * 시각이 들어가는 응답(STS:)과 진행 알림(PRG:)은 비교에서 뺍니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "../transport.h"
+
+/**
+ * @brief 스크립트 재생 수신 경로 클래스
+ */
+class ReplayTransport : public ITransport {
+public:
+    /**
+     * @param transport_name 경로 이름
+     * @param primary 두 번째 클라이언트이면 스크립트를 재생하는 경로 (그 경로가 대신 보내고 응답을 기록)
+     */
+    explicit ReplayTransport(const char* transport_name = "replay", ReplayTransport* primary = NULL);
+
+    const char* name() const override { return transport_name; }
+
+    /**
+     * @brief hostOptions.replay_path 스크립트를 읽고 재생 태스크 시작 (경로가 없으면 아무것도 안 함)
+     *
+     * 두 번째 클라이언트는 처리 함수만 등록하고, 재생 태스크가 등록을 기다린 뒤 시작합니다.
+     */
+    bool begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) override;
+
+    void notify(const String& message) override;
+
+    bool connected() const override { return running; }
+
+    size_t mtu() const override { return MAX_MESSAGE_BYTES; }
+
+private:
+    // 스크립트 한 단계
+    struct Step {
+        std::string message;
+        bool wait;            ///< 보낸 뒤 구간이 끝날 때까지 기다림
+        bool second;          ///< 두 번째 클라이언트가 보냄
+        uint32_t budget_ms;   ///< 구간 시간 예산 (0: 없음)
+        int line;             ///< 스크립트 줄 번호 (보고용)
+    };
+
+    bool load(const char* path);
+    static bool unescape(const std::string& text, std::string& out);
+    static std::string escape(const std::string& message);
+    static bool isJobReply(const std::string& text);
+
+    /**
+     * @brief 응답 기록 (두 번째 클라이언트의 응답은 second로 표시)
+     */
+    void record(const String& message, bool second);
+
+    static void replayTask(void* parameter);
+    static void onHidReport(uint8_t modifiers, uint8_t key);
+
+    /**
+     * @brief 전체 스크립트 재생
+     * @return 프로세스 종료 코드 (0: 모두 통과)
+     */
+    int run();
+
+    /**
+     * @brief 결과 트레이스를 기준 트레이스와 비교 (다른 첫 줄 보고)
+     */
+    bool compareGolden(const std::string& result) const;
+
+    const char* transport_name;
+    ReplayTransport* primary;     ///< 두 번째 클라이언트의 재생 경로 (재생 경로이면 NULL)
+    ReplayTransport* secondary;   ///< 재생 경로의 두 번째 클라이언트 (없으면 NULL)
+    std::vector<Step> steps;
+    volatile bool running;
+
+    // 현재 구간 기록 (lock으로 보호 - 응답은 여러 태스크에서, HID 리포트는 loop()에서 옴)
+    std::mutex lock;
+    std::condition_variable changed;
+    std::vector<std::string> replies;   ///< 트레이스 줄 그대로 ("< ..." 또는 "2< ...")
+    std::vector<std::string> reports;
+    uint32_t queued;          ///< 구간에서 큐에 들어간 작업 수
+    uint32_t finished;        ///< 구간에서 끝난 작업 수
+    uint32_t last_reply_ms;   ///< 마지막 응답 시각 (가상 시계)
+
+    static ReplayTransport* instance;
+};
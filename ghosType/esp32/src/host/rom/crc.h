@@ -0,0 +1,15 @@
+/**
+ * @file crc.h
+ * @brief 호스트 빌드용 ESP32 ROM CRC 함수 대체 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief ROM crc32_le와 같은 규칙의 CRC-32 (초기값/결과 반전, zlib과 동일)
+ */
+uint32_t crc32_le(uint32_t crc, const uint8_t* buffer, uint32_t length);
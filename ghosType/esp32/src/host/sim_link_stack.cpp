@@ -0,0 +1,57 @@
+/**
+ * @file sim_link_stack.cpp
+ * @brief 호스트 빌드용 링크 제어 스택 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "sim_link_stack.h"
+
+SimLinkStack::SimLinkStack()
+    : params_pending(false), params_ok(false), interval(0), latency(0), timeout(0),
+      data_length_pending(false), data_length(0), phy_pending(false) {
+}
+
+bool SimLinkStack::requestConnParams(uint16_t min_interval, uint16_t max_interval, uint16_t new_latency, uint16_t new_timeout) {
+    uint16_t accepted = min_interval < SIM_CENTRAL_MIN_INTERVAL ? SIM_CENTRAL_MIN_INTERVAL : min_interval;
+    params_ok = accepted <= max_interval;
+    if (params_ok) {
+        interval = accepted;
+        latency = new_latency;
+        timeout = new_timeout;
+    }
+    params_pending = true;
+    return true;
+}
+
+bool SimLinkStack::requestDataLength(uint16_t tx_octets) {
+    data_length = tx_octets < SIM_CENTRAL_DATA_LENGTH ? tx_octets : SIM_CENTRAL_DATA_LENGTH;
+    data_length_pending = true;
+    return true;
+}
+
+bool SimLinkStack::requestPhy2M() {
+    phy_pending = true;
+    return true;
+}
+
+void SimLinkStack::poll(LinkManager& link) {
+    if (data_length_pending) {
+        data_length_pending = false;
+        link.dataLengthUpdated(true, data_length, data_length);
+    }
+    if (phy_pending) {
+        phy_pending = false;
+        link.phyUpdated(true, true, true);
+    }
+    if (params_pending) {
+        params_pending = false;
+        link.paramsUpdated(params_ok, interval, latency, timeout);
+    }
+}
+
+void SimLinkStack::reset() {
+    params_pending = false;
+    data_length_pending = false;
+    phy_pending = false;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file sim_link_stack.h
+ * @brief 호스트 빌드용 링크 제어 스택 - 중앙 장치(휴대폰/PC)의 응답을 흉내 냄
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 소켓에는 연결 간격이나 PHY가 없지만, 같은 링크 관리 정책(link_manager.h)을 그대로 돌려
+ * 대량 전송 진입/완화, 요청 간격 제한, 거부 처리를 STS의 "link"로 확인할 수 있게 합니다.
+ * 흔한 중앙 장치처럼 15ms보다 짧은 간격은 15ms로 올려 받아 주고, 그래도 요청한 최대 간격보다
+ * 길면 거부합니다. DLE는 251바이트까지, PHY는 2M을 지원합니다.
+ * 요청은 바로 완료하지 않고 다음 poll()에서 결과 이벤트로 돌려줍니다 (실제 스택의 비동기 이벤트와 같음).
+ * 소켓 수신 태스크 하나에서만 요청하고 poll()하므로 잠금은 없습니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "../link_manager.h"
+
+#define SIM_CENTRAL_MIN_INTERVAL 12     // 15ms - 중앙 장치가 허용하는 최소 연결 간격 (1.25ms 단위)
+#define SIM_CENTRAL_DATA_LENGTH 251     // 중앙 장치가 지원하는 최대 데이터 길이
+
+/**
+ * @brief 중앙 장치 흉내 링크 스택
+ */
+class SimLinkStack : public ILinkStack {
+public:
+    SimLinkStack();
+
+    bool requestConnParams(uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout) override;
+    bool requestDataLength(uint16_t tx_octets) override;
+    bool requestPhy2M() override;
+
+    /**
+     * @brief 미뤄 둔 요청 결과를 링크 관리에 전달
+     */
+    void poll(LinkManager& link);
+
+    /**
+     * @brief 연결 해제 - 처리하지 않은 요청 버림
+     */
+    void reset();
+
+private:
+    bool params_pending;
+    bool params_ok;
+    uint16_t interval;
+    uint16_t latency;
+    uint16_t timeout;
+
+    bool data_length_pending;
+    uint16_t data_length;
+
+    bool phy_pending;
+};
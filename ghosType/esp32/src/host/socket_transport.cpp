@@ -0,0 +1,98 @@
+/**
+ * @file socket_transport.cpp
+ * @brief 호스트 빌드용 유닉스 도메인 소켓 수신 경로 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "socket_transport.h"
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+#include "host_options.h"
+
+int SocketTransport::listen_fd = -1;
+
+SocketTransport::SocketTransport(const char* name) : transport_name(name), client_fd(-1), link_manager(link_stack) {
+}
+
+bool SocketTransport::begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) {
+    if (!hostOptions.socket_path) {
+        return false;  // 스크립트 재생 중
+    }
+    receive_handler = on_receive;
+    connection_handler = on_connection;
+    link_manager.initialize();
+    if (listen_fd >= 0) {
+        // 앞 객체가 만든 소켓에서 함께 accept() (begin은 setup에서 차례로 호출)
+        return xTaskCreatePinnedToCore(receiveTask, "Socket_Task", 0, this, 1, NULL, 0) == pdPASS;
+    }
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, hostOptions.socket_path, sizeof(address.sun_path) - 1);
+    unlink(address.sun_path);  // 이전 실행이 남긴 소켓 파일
+
+    listen_fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (listen_fd < 0 ||
+        bind(listen_fd, (sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listen_fd, 4) != 0) {
+        perror(hostOptions.socket_path);
+        return false;
+    }
+    return xTaskCreatePinnedToCore(receiveTask, "Socket_Task", 0, this, 1, NULL, 0) == pdPASS;
+}
+
+void SocketTransport::receiveTask(void* parameter) {
+    SocketTransport* self = (SocketTransport*)parameter;
+    // 최대 크기보다 1바이트 크게 받아 너무 긴 메시지를 구분
+    std::vector<uint8_t> buffer(MAX_MESSAGE_BYTES + 1);
+
+    while (true) {
+        int fd = accept(self->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            continue;
+        }
+        self->client_fd = fd;
+        self->link_manager.connected(millis());
+        self->connectionChanged(true);
+
+        uint32_t last_tick = millis();
+        while (true) {
+            // 메시지가 없어도 LINK_TICK_MS마다 깨어나 링크 관리 주기 확인
+            pollfd waiting = { fd, POLLIN, 0 };
+            int ready = poll(&waiting, 1, LINK_TICK_MS);
+            if (ready > 0) {
+                ssize_t length = recv(fd, buffer.data(), buffer.size(), 0);
+                if (length <= 0) {
+                    break;  // 연결 끊김
+                }
+                self->link_manager.received(buffer.data(), (size_t)length, millis());
+                self->deliver(buffer.data(), (size_t)length);
+            }
+            if (millis() - last_tick >= LINK_TICK_MS) {
+                last_tick = millis();
+                self->link_manager.tick(last_tick);
+            }
+            self->link_stack.poll(self->link_manager);
+        }
+        self->link_stack.reset();
+        self->link_manager.disconnected();
+
+        {
+            std::lock_guard<std::mutex> guard(self->send_lock);
+            self->client_fd = -1;
+            close(fd);
+        }
+        self->connectionChanged(false);
+    }
+}
+
+void SocketTransport::notify(const String& message) {
+    std::lock_guard<std::mutex> guard(send_lock);
+    if (client_fd >= 0) {
+        send(client_fd, message.c_str(), message.length(), MSG_NOSIGNAL);
+    }
+}
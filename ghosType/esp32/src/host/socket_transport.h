@@ -0,0 +1,60 @@
+/**
+ * @file socket_transport.h
+ * @brief 호스트 빌드용 유닉스 도메인 소켓 수신 경로
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * SOCK_SEQPACKET 소켓은 메시지 경계를 유지하므로 send() 하나가 BLE 쓰기 하나와 같습니다.
+ * 응답도 메시지 하나씩 돌려보냅니다. 객체 하나가 한 번에 한 클라이언트만 받으며,
+ * 연결이 끊기면 다음 클라이언트를 기다립니다 (BLE 광고 재시작과 같은 동작).
+ * 여러 객체가 같은 수신 대기 소켓을 나눠 써서 클라이언트 여럿이 동시에 연결할 수 있습니다.
+ * (기기의 BLE와 USB CDC처럼 각자 다른 클라이언트 - 다중 클라이언트 스케줄링 시험용)
+ * BLE 경로와 같은 링크 관리 정책을 중앙 장치 흉내 스택(sim_link_stack.h)에 대고 돌립니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <mutex>
+#include "../transport.h"
+#include "../link_manager.h"
+#include "sim_link_stack.h"
+
+/**
+ * @brief 유닉스 도메인 소켓 수신 경로 클래스
+ */
+class SocketTransport : public ITransport {
+public:
+    /**
+     * @param name 경로 이름 (상태 보고의 클라이언트 이름)
+     */
+    explicit SocketTransport(const char* name);
+
+    const char* name() const override { return transport_name; }
+
+    /**
+     * @brief hostOptions.socket_path에서 수신 대기 시작 (수신 스레드 생성, 경로가 없으면 아무것도 안 함)
+     *
+     * 수신 대기 소켓은 처음 begin()한 객체가 만들고 나머지는 같은 소켓에서 accept()합니다.
+     */
+    bool begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) override;
+
+    void notify(const String& message) override;
+
+    bool connected() const override { return client_fd >= 0; }
+
+    size_t mtu() const override { return MAX_MESSAGE_BYTES; }
+
+    const LinkManager* link() const override { return &link_manager; }
+
+private:
+    static void receiveTask(void* parameter);
+
+    static int listen_fd;   ///< 모든 객체가 나눠 쓰는 수신 대기 소켓
+
+    const char* transport_name;
+    volatile int client_fd;
+    std::mutex send_lock;   ///< 여러 태스크의 응답 전송 직렬화
+    SimLinkStack link_stack;
+    LinkManager link_manager;
+};
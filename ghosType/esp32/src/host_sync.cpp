@@ -0,0 +1,175 @@
+/**
+ * @file host_sync.cpp
+ * @brief HID LED 출력 리포트를 이용한 호스트 동기화 및 적응형 속도 조절 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "host_sync.h"
+
+HostSync::HostSync()
+    : led_state(0), led_reports(0), is_adaptive(false), ime_led(false), supported(true),
+      gap_ms(1000 / DEFAULT_TYPING_SPEED_CPS), max_gap_ms(1000 / MIN_TYPING_SPEED_CPS), keys_since_barrier(0), consecutive_timeouts(0) {
+    memset(&sync_stats, 0, sizeof(sync_stats));
+}
+
+void HostSync::onLedReport(uint8_t leds) {
+    led_state = leds;
+    led_reports = led_reports + 1;
+}
+
+uint8_t HostSync::imeMode() const {
+    if (!ime_led || led_reports == 0) {
+        return IME_MODE_UNKNOWN;
+    }
+    return (led_state & HID_LED_KANA) ? IME_MODE_KOREAN : IME_MODE_ENGLISH;
+}
+
+bool HostSync::needsToggle(const KeyEvent& event) {
+    bool conditional = (event.modifiers & KEY_TOGGLE_CONDITIONAL) != 0;
+    uint8_t current = imeMode();
+    if (current == IME_MODE_UNKNOWN || event.code == IME_MODE_UNKNOWN) {
+        // 모드를 모르면 예전처럼 동작 (조건부 전환은 호스트가 이미 그 모드라고 가정)
+        return !conditional;
+    }
+    if (current == event.code) {
+        if (!conditional) {
+            sync_stats.toggles_skipped++;
+        }
+        return false;
+    }
+    if (conditional) {
+        sync_stats.toggles_added++;
+    }
+    return true;
+}
+
+void HostSync::noteToggle() {
+    if (ime_led) {
+        led_state = led_state ^ HID_LED_KANA;
+    }
+}
+
+uint8_t HostSync::modifiersFor(const KeyEvent& event) {
+    uint8_t modifiers = event.modifiers & ~KEY_CHAR_END;
+    // A~Z 키만 Caps Lock의 영향을 받음 (AltGr 조합과 한글 자모 키 제외)
+    if (!(led_state & HID_LED_CAPS_LOCK) || event.code < 0x04 || event.code > 0x1D ||
+        event.role != JAMO_ROLE_NONE || (modifiers & HID_MOD_RIGHT_ALT)) {
+        return modifiers;
+    }
+    sync_stats.caps_adjusted++;
+    return modifiers ^ HID_MOD_LEFT_SHIFT;
+}
+
+void HostSync::setAdaptive(bool enabled, uint32_t start_gap_ms) {
+    is_adaptive = enabled;
+    gap_ms = CLAMP(start_gap_ms, SYNC_MIN_KEY_GAP_MS, 1000 / MIN_TYPING_SPEED_CPS);
+    // 밀림/무응답이 이어져도 설정 속도보다 한없이 느려지지 않도록 상한을 둠
+    max_gap_ms = CLAMP(gap_ms * SYNC_MAX_GAP_PERCENT / 100, gap_ms, 1000 / MIN_TYPING_SPEED_CPS);
+    keys_since_barrier = 0;
+    // 다시 켜면 호스트가 바뀌었을 수 있으므로 응답 여부와 기준 왕복 시간을 다시 측정
+    supported = true;
+    consecutive_timeouts = 0;
+    sync_stats.min_rtt_ms = 0;
+}
+
+uint32_t HostSync::keyDelayUs(uint32_t requested_us) const {
+    return is_adaptive && supported ? gap_ms * 1000UL : requested_us;
+}
+
+bool HostSync::keyTyped(const KeyEvent& event) {
+    if (!is_adaptive || !supported) {
+        return false;
+    }
+    if (event.kind == KEY_EVENT_CHAR) {
+        keys_since_barrier++;
+    }
+    // 잠금 키가 조합 중인 음절을 확정하지 않도록 한글이 아닌 키 뒤에서만 장벽을 세움
+    if (keys_since_barrier < SYNC_BARRIER_INTERVAL_KEYS || event.role != JAMO_ROLE_NONE) {
+        return false;
+    }
+    keys_since_barrier = 0;
+    return true;
+}
+
+bool HostSync::waitForLed(uint8_t mask, bool on, uint32_t timeout_ms) const {
+    uint32_t started = millis();
+    while (((led_state & mask) != 0) != on) {
+        if (millis() - started >= timeout_ms) {
+            return false;
+        }
+        delay(1);
+    }
+    return true;
+}
+
+void HostSync::recordBarrier(bool echoed, uint32_t rtt_ms) {
+    if (!echoed) {
+        sync_stats.timeouts++;
+        if (++consecutive_timeouts >= SYNC_MAX_TIMEOUTS) {
+            // LED 리포트를 돌려보내지 않거나 중간에 멈춘 호스트 - 장벽을 멈추고 speed_cps로 복귀
+            supported = false;
+            return;
+        }
+        gap_ms = MIN(gap_ms * SYNC_SLOWDOWN_PERCENT / 100, max_gap_ms);
+        return;
+    }
+
+    consecutive_timeouts = 0;
+    sync_stats.barriers++;
+    sync_stats.last_rtt_ms = rtt_ms;
+    if (sync_stats.min_rtt_ms == 0 || rtt_ms < sync_stats.min_rtt_ms) {
+        sync_stats.min_rtt_ms = rtt_ms;
+    }
+
+    if (rtt_ms > sync_stats.min_rtt_ms + SYNC_LAG_THRESHOLD_MS) {
+        // 호스트 입력 처리가 밀림 - 간격을 크게 늘림
+        sync_stats.lagged++;
+        gap_ms = MIN(gap_ms * SYNC_SLOWDOWN_PERCENT / 100 + 1, max_gap_ms);
+    } else {
+        // 따라오고 있음 - 간격을 조금씩 줄임
+        gap_ms = MAX(gap_ms * SYNC_SPEEDUP_PERCENT / 100, SYNC_MIN_KEY_GAP_MS);
+    }
+}
+
+uint32_t HostSync::barrierCostMs() const {
+    if (!is_adaptive || !supported) {
+        return 0;
+    }
+    uint32_t pass_ms = sync_stats.barriers == 0 || consecutive_timeouts > 0
+                           ? SYNC_BARRIER_TIMEOUT_MS : sync_stats.last_rtt_ms;
+    return pass_ms * 2;
+}
+
+String HostSync::statsJson() const {
+    String json = "{\"adaptive\":";
+    json += is_adaptive ? "true" : "false";
+    json += ",\"supported\":";
+    json += supported ? "true" : "false";
+    json += ",\"gap_ms\":";
+    json += gap_ms;
+    json += ",\"rtt_ms\":";
+    json += sync_stats.last_rtt_ms;
+    json += ",\"rtt_min\":";
+    json += sync_stats.min_rtt_ms;
+    json += ",\"barriers\":";
+    json += sync_stats.barriers;
+    json += ",\"lagged\":";
+    json += sync_stats.lagged;
+    json += ",\"timeouts\":";
+    json += sync_stats.timeouts;
+    json += ",\"leds\":";
+    json += (unsigned int)led_reports;
+    json += ",\"caps\":";
+    json += (led_state & HID_LED_CAPS_LOCK) ? "true" : "false";
+    json += ",\"ime\":\"";
+    json += imeMode() == IME_MODE_KOREAN ? "ko" : imeMode() == IME_MODE_ENGLISH ? "en" : "unknown";
+    json += "\",\"toggles_skipped\":";
+    json += sync_stats.toggles_skipped;
+    json += ",\"toggles_added\":";
+    json += sync_stats.toggles_added;
+    json += ",\"caps_adjusted\":";
+    json += sync_stats.caps_adjusted;
+    json += "}";
+    return json;
+}
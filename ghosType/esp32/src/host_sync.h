@@ -0,0 +1,162 @@
+/**
+ * @file host_sync.h
+ * @brief HID LED 출력 리포트를 이용한 호스트 동기화 및 적응형 속도 조절
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 호스트는 잠금 키(Num/Caps/Scroll Lock)를 처리한 뒤 LED 출력 리포트로 새 상태를
+ * 돌려보냅니다. 타이핑 중 주기적으로 Scroll Lock을 눌러 LED 응답이 올 때까지의
+ * 왕복 시간을 재면, 호스트가 앞서 보낸 키를 모두 처리했는지(동기화 장벽)와
+ * 입력이 밀리고 있는지를 알 수 있습니다.
+ *
+ * 적응형 모드에서는 왕복 시간이 최소값 근처이면 키 간격을 줄이고, 밀리거나 응답이
+ * 없으면 늘려서 호스트마다 밀리지 않는 가장 빠른 속도를 찾습니다.
+ * LED 리포트를 돌려보내지 않는 호스트는 몇 번의 무응답 뒤 장벽을 중단하고
+ * speed_cps 설정으로 돌아갑니다.
+ *
+ * 같은 리포트로 호스트의 Caps Lock 상태와 (IME가 Kana LED로 한글 모드를 알려 주는
+ * 호스트에서는) 한영 모드를 추적해, Caps Lock이 켜져 있으면 영문자의 Shift를 뒤집고
+ * 이미 원하는 모드이면 한영 전환을 건너뜁니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+// HID LED 출력 리포트 비트
+#define HID_LED_NUM_LOCK 0x01
+#define HID_LED_CAPS_LOCK 0x02
+#define HID_LED_SCROLL_LOCK 0x04
+#define HID_LED_KANA 0x10
+
+/**
+ * @brief 동기화 장벽 통계
+ */
+struct HostSyncStats {
+    uint32_t barriers;        ///< 응답을 받은 장벽 수
+    uint32_t timeouts;        ///< 응답이 없었던 장벽 수
+    uint32_t lagged;          ///< 밀린 것으로 판단한 장벽 수
+    uint32_t last_rtt_ms;     ///< 마지막 왕복 시간
+    uint32_t min_rtt_ms;      ///< 최소 왕복 시간 (호스트가 밀리지 않을 때의 기준)
+    uint32_t toggles_skipped; ///< 호스트가 이미 원하는 모드라 건너뛴 한영 전환 수
+    uint32_t toggles_added;   ///< 호스트 모드가 달라 조건부로 입력한 한영 전환 수
+    uint32_t caps_adjusted;   ///< Caps Lock 때문에 Shift를 뒤집은 키 수
+};
+
+/**
+ * @brief 호스트 동기화 클래스
+ *
+ * onLedReport()는 USB 이벤트 태스크에서, 나머지는 타이핑 루프에서 호출합니다.
+ */
+class HostSync {
+public:
+    HostSync();
+
+    /**
+     * @brief LED 출력 리포트 수신 (USB 이벤트 콜백에서 호출)
+     * @param leds HID LED 비트
+     */
+    void onLedReport(uint8_t leds);
+
+    /**
+     * @brief 마지막으로 받은 LED 상태
+     */
+    uint8_t leds() const { return led_state; }
+
+    /**
+     * @brief 호스트 IME가 한글 모드를 Kana LED로 알려 주는지 설정
+     * @param mirrored true이면 Kana LED 켜짐 = 한글 모드로 간주
+     */
+    void setImeLed(bool mirrored) { ime_led = mirrored; }
+
+    /**
+     * @brief 현재 호스트 IME 모드
+     * @return ImeMode (Kana LED를 쓰지 않는 호스트는 IME_MODE_UNKNOWN)
+     */
+    uint8_t imeMode() const;
+
+    /**
+     * @brief 한영 전환 이벤트를 실제로 입력해야 하는지 판단
+     * @param event KEY_EVENT_TOGGLE 이벤트
+     * @return true 입력해야 함 (모드를 모르면 조건부가 아닌 전환만 입력)
+     */
+    bool needsToggle(const KeyEvent& event);
+
+    /**
+     * @brief 한영 전환을 입력했음을 기록 (LED 리포트가 오기 전까지 모드를 뒤집어 둠)
+     */
+    void noteToggle();
+
+    /**
+     * @brief Caps Lock 상태를 반영한 수정키
+     * @param event KEY_EVENT_CHAR 이벤트
+     * @return HID 수정키 (KEY_CHAR_END 제외), Caps Lock이 켜져 있으면 영문자(한글 자모 키 제외)의 Shift를 뒤집은 값
+     */
+    uint8_t modifiersFor(const KeyEvent& event);
+
+    /**
+     * @brief 적응형 속도 조절 켜기/끄기
+     * @param enabled true이면 장벽 결과로 키 간격을 조절
+     * @param start_gap_ms 시작 키 간격 (현재 speed_cps 기준)
+     */
+    void setAdaptive(bool enabled, uint32_t start_gap_ms);
+
+    bool adaptive() const { return is_adaptive; }
+
+    /**
+     * @brief 이번 작업에 쓸 기본 키 간격
+     * @param requested_us speed_cps에 따른 간격 (마이크로초)
+     * @return 적응형 모드이면 학습한 간격, 아니면 requested_us (마이크로초)
+     */
+    uint32_t keyDelayUs(uint32_t requested_us) const;
+
+    /**
+     * @brief 이벤트 하나를 입력했음을 기록하고 장벽을 세울 때인지 확인
+     * @param event 방금 입력한 이벤트
+     * @return true 지금 장벽을 세워야 함 (한글 조합 중에는 세우지 않음)
+     */
+    bool keyTyped(const KeyEvent& event);
+
+    /**
+     * @brief LED 비트가 원하는 상태가 될 때까지 대기
+     * @param mask 확인할 LED 비트
+     * @param on 원하는 상태
+     * @param timeout_ms 최대 대기 시간
+     * @return true 응답 받음
+     */
+    bool waitForLed(uint8_t mask, bool on, uint32_t timeout_ms) const;
+
+    /**
+     * @brief 장벽 결과를 기록하고 키 간격 조절
+     * @param echoed 호스트가 LED로 응답했는지
+     * @param rtt_ms 잠금 키 입력부터 응답까지 걸린 시간
+     */
+    void recordBarrier(bool echoed, uint32_t rtt_ms);
+
+    /**
+     * @brief 동기화 장벽 한 번(잠금 키 두 번)의 예상 대기 시간 (예상 완료 시간 계산용)
+     * @return 장벽을 세우지 않으면 0, 마지막 왕복 시간 기준 (측정 전이거나 무응답 중이면 제한 시간 기준)
+     */
+    uint32_t barrierCostMs() const;
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"adaptive":b,"supported":b,"gap_ms":n,"rtt_ms":n,"rtt_min":n,"barriers":n,"lagged":n,"timeouts":n,"leds":n,
+     *          "caps":b,"ime":"ko|en|unknown","toggles_skipped":n,"toggles_added":n,"caps_adjusted":n}
+     */
+    String statsJson() const;
+
+private:
+    volatile uint8_t led_state;
+    volatile uint32_t led_reports;
+    bool is_adaptive;
+    bool ime_led;             ///< Kana LED가 한글 모드를 나타내는지
+    bool supported;           ///< 호스트가 LED 리포트로 응답하는지 (무응답이 이어지면 false)
+    uint32_t gap_ms;          ///< 학습한 키 간격
+    uint32_t max_gap_ms;      ///< 키 간격 상한 (시작 간격의 SYNC_MAX_GAP_PERCENT)
+    uint32_t keys_since_barrier;
+    uint32_t consecutive_timeouts;
+    HostSyncStats sync_stats;
+};
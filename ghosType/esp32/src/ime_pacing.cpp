@@ -0,0 +1,71 @@
+/**
+ * @file ime_pacing.cpp
+ * @brief 한글 조합 역할별 키 사이 최소 간격 표 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "ime_pacing.h"
+#include <string.h>
+
+// JamoRole 순서의 역할 이름 (CFG 설정용)
+static const char* const ROLE_NAMES[JAMO_ROLE_COUNT] = {
+    "none", "cho", "carry", "jung", "jung2", "jong", "jong2"
+};
+
+ImePacing::ImePacing() : slowed(0), added_us(0) {
+    reset();
+}
+
+void ImePacing::reset() {
+    memset(gap_ms, 0, sizeof(gap_ms));
+    // 받침으로 붙었던 자음이 모음 키에서 다음 음절 초성으로 옮겨 가는 전환
+    gap_ms[JAMO_ROLE_CHOSEONG_CARRY][JAMO_ROLE_JUNGSEONG] = IME_GAP_CARRY_MS;
+    // 겹모음/겹받침 - 둘째 키가 첫 키와 합쳐져야 함
+    gap_ms[JAMO_ROLE_JUNGSEONG][JAMO_ROLE_JUNGSEONG_COMPOUND] = IME_GAP_COMPOUND_VOWEL_MS;
+    gap_ms[JAMO_ROLE_JONGSEONG][JAMO_ROLE_JONGSEONG_COMPOUND] = IME_GAP_COMPOUND_FINAL_MS;
+}
+
+bool ImePacing::set(uint8_t from, uint8_t to, uint32_t gap) {
+    if (from >= JAMO_ROLE_COUNT || to >= JAMO_ROLE_COUNT) {
+        return false;
+    }
+    gap_ms[from][to] = gap < IME_GAP_MAX_MS ? gap : IME_GAP_MAX_MS;
+    return true;
+}
+
+uint32_t ImePacing::delayAfter(const KeyEvent& current, const KeyEvent* next, uint32_t base_us) {
+    if (!next || current.kind != KEY_EVENT_CHAR || next->kind != KEY_EVENT_CHAR) {
+        return base_us;
+    }
+    uint32_t gap = gapUs(current.role, next->role, base_us);
+    if (gap > base_us) {
+        slowed++;
+        added_us += gap - base_us;
+    }
+    return gap;
+}
+
+uint32_t ImePacing::gapUs(uint8_t from, uint8_t to, uint32_t base_us) const {
+    uint32_t gap = gap_ms[from][to] * 1000UL;
+    return gap > base_us ? gap : base_us;
+}
+
+bool ImePacing::roleFromName(const char* name, uint8_t& role) {
+    for (uint8_t i = 0; i < JAMO_ROLE_COUNT; i++) {
+        if (strcmp(name, ROLE_NAMES[i]) == 0) {
+            role = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+String ImePacing::statsJson() const {
+    String json = "{\"slowed\":";
+    json += slowed;
+    json += ",\"added_ms\":";
+    json += added_us / 1000;
+    json += "}";
+    return json;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file ime_pacing.h
+ * @brief 한글 조합 역할별 키 사이 최소 간격 표
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 두벌식 IME는 자모 키를 받으며 음절을 조합하는데, 빠른 속도에서는 특정 키 전환을
+ * 놓치거나 잘못 조합합니다. 대표적으로 앞 음절의 받침으로 붙었던 자음이 다음 모음
+ * 키에서 새 음절의 초성으로 옮겨 가는 전환(가나: 간 → 가나)과 겹모음/겹받침의
+ * 둘째 키입니다. 작업 전체의 속도를 낮추는 대신 (앞 키 역할, 다음 키 역할) 쌍마다
+ * 최소 간격을 두어 위험한 전환만 늦추고 나머지는 설정된 속도 그대로 입력합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+/**
+ * @brief 조합 역할 전환별 최소 간격 표
+ */
+class ImePacing {
+public:
+    ImePacing();
+
+    /**
+     * @brief 표를 기본값으로 되돌림 (config.h의 IME_GAP_* 값)
+     */
+    void reset();
+
+    /**
+     * @brief 전환 하나의 최소 간격 설정
+     * @param from 앞 키의 JamoRole
+     * @param to 다음 키의 JamoRole
+     * @param gap_ms 최소 간격 (0: 속도 설정을 그대로 따름, IME_GAP_MAX_MS로 제한)
+     * @return false 역할 번호가 범위를 벗어남
+     */
+    bool set(uint8_t from, uint8_t to, uint32_t gap_ms);
+
+    /**
+     * @brief 키 하나를 입력한 뒤 다음 키까지의 간격
+     * @param current 방금 입력한 이벤트
+     * @param next 다음 이벤트 (NULL: 마지막 이벤트)
+     * @param base_us 속도 설정에 따른 기본 간격 (마이크로초)
+     * @return 기본 간격과 전환별 최소 간격 중 큰 값 (마이크로초)
+     */
+    uint32_t delayAfter(const KeyEvent& current, const KeyEvent* next, uint32_t base_us);
+
+    /**
+     * @brief 일반 키 사이 전환 하나의 간격 (통계에 남기지 않음, 예상 시간 계산용)
+     * @param from 앞 키의 JamoRole
+     * @param to 다음 키의 JamoRole
+     * @param base_us 속도 설정에 따른 기본 간격 (마이크로초)
+     * @return 기본 간격과 전환별 최소 간격 중 큰 값 (마이크로초)
+     */
+    uint32_t gapUs(uint8_t from, uint8_t to, uint32_t base_us) const;
+
+    /**
+     * @brief 역할 이름으로 역할 번호 찾기
+     * @param name "none", "cho", "carry", "jung", "jung2", "jong", "jong2"
+     * @param[out] role 찾은 JamoRole
+     * @return true 찾음
+     */
+    static bool roleFromName(const char* name, uint8_t& role);
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"slowed":n,"added_ms":n}
+     */
+    String statsJson() const;
+
+private:
+    uint16_t gap_ms[JAMO_ROLE_COUNT][JAMO_ROLE_COUNT];
+    uint32_t slowed;          ///< 간격을 늘린 전환 수
+    uint32_t added_us;        ///< 늘린 간격의 합
+};
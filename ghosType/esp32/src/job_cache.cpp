@@ -0,0 +1,169 @@
+/**
+ * @file job_cache.cpp
+ * @brief 컴파일된 작업 캐시 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "job_cache.h"
+
+JobCache::JobCache() : used_bytes(0), use_counter(0), cache_stats() {
+    memset(entries, 0, sizeof(entries));
+}
+
+uint32_t JobCache::hashText(const char* text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool JobCache::probe(uint32_t hash, uint32_t text_length, uint8_t layout) {
+    cache_stats.probes++;
+
+    CachedJob* entry = find(hash, text_length, layout);
+    if (!entry) {
+        cache_stats.misses++;
+        return false;
+    }
+
+    cache_stats.hits++;
+    entry->last_used = ++use_counter;
+    return true;
+}
+
+bool JobCache::fetch(uint32_t hash, uint32_t text_length, uint8_t layout,
+                     std::vector<KeyEvent>& events, CachedJobSettings& settings) {
+    CachedJob* entry = find(hash, text_length, layout);
+    if (!entry) {
+        return false;
+    }
+
+    events.assign(entry->events, entry->events + entry->event_count);
+    settings = entry->settings;
+    entry->last_used = ++use_counter;
+    // 조회 적중 후 실제로 재생할 때만 절약으로 집계 (그 사이 밀려나면 클라이언트가 다시 보냄)
+    cache_stats.bytes_saved += entry->source_bytes;
+    return true;
+}
+
+void JobCache::store(uint32_t hash, uint32_t text_length, uint8_t layout, const CachedJobSettings& settings,
+                     uint32_t source_bytes, const std::vector<KeyEvent>& events) {
+    size_t size = events.size() * sizeof(KeyEvent);
+    if (size == 0 || size > JOB_CACHE_MAX_BYTES) {
+        return;
+    }
+
+    // 같은 내용을 같은 설정으로 컴파일한 항목이 있으면 갱신만 (설정이 다르면 새 결과로 교체)
+    CachedJob* existing = find(hash, text_length, layout);
+    if (existing) {
+        if (existing->settings.layout == settings.layout && existing->settings.speed_cps == settings.speed_cps &&
+            existing->settings.progress_ms == settings.progress_ms) {
+            existing->last_used = ++use_counter;
+            return;
+        }
+        evict(*existing);
+    }
+
+    // 빈 칸과 용량이 생길 때까지 LRU 항목 제거
+    CachedJob* slot = NULL;
+    while (true) {
+        slot = NULL;
+        for (size_t i = 0; i < JOB_CACHE_MAX_ENTRIES; i++) {
+            if (!entries[i].events) {
+                slot = &entries[i];
+                break;
+            }
+        }
+        if (slot && used_bytes + size <= JOB_CACHE_MAX_BYTES) {
+            break;
+        }
+        CachedJob* victim = leastRecentlyUsed();
+        if (!victim) {
+            return;
+        }
+        evict(*victim);
+        cache_stats.evictions++;
+    }
+
+    KeyEvent* buffer = (KeyEvent*)allocate(size);
+    if (!buffer) {
+        return;
+    }
+    memcpy(buffer, events.data(), size);
+
+    slot->hash = hash;
+    slot->text_length = text_length;
+    slot->layout = layout;
+    slot->settings = settings;
+    slot->source_bytes = source_bytes;
+    slot->events = buffer;
+    slot->event_count = events.size();
+    slot->last_used = ++use_counter;
+    used_bytes += size;
+}
+
+String JobCache::statsJson() const {
+    size_t count = 0;
+    for (size_t i = 0; i < JOB_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].events) {
+            count++;
+        }
+    }
+    uint32_t hit_rate = cache_stats.probes > 0 ? cache_stats.hits * 100 / cache_stats.probes : 0;
+
+    String json = "{\"entries\":";
+    json += (unsigned int)count;
+    json += ",\"bytes\":";
+    json += (unsigned int)used_bytes;
+    json += ",\"probes\":";
+    json += cache_stats.probes;
+    json += ",\"hits\":";
+    json += cache_stats.hits;
+    json += ",\"hit_rate\":";
+    json += hit_rate;
+    json += ",\"saved\":";
+    json += cache_stats.bytes_saved;
+    json += ",\"evicted\":";
+    json += cache_stats.evictions;
+    json += "}";
+    return json;
+}
+
+CachedJob* JobCache::find(uint32_t hash, uint32_t text_length, uint8_t layout) {
+    for (size_t i = 0; i < JOB_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].events && entries[i].hash == hash &&
+            entries[i].text_length == text_length && entries[i].layout == layout) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+CachedJob* JobCache::leastRecentlyUsed() {
+    CachedJob* oldest = NULL;
+    for (size_t i = 0; i < JOB_CACHE_MAX_ENTRIES; i++) {
+        if (entries[i].events && (!oldest || entries[i].last_used < oldest->last_used)) {
+            oldest = &entries[i];
+        }
+    }
+    return oldest;
+}
+
+void JobCache::evict(CachedJob& entry) {
+    used_bytes -= entry.event_count * sizeof(KeyEvent);
+    free(entry.events);
+    memset(&entry, 0, sizeof(entry));
+}
+
+void* JobCache::allocate(size_t size) {
+#ifdef BOARD_HAS_PSRAM
+    // 큰 버퍼는 PSRAM에 두어 내부 RAM을 아낌
+    if (psramFound()) {
+        return ps_malloc(size);
+    }
+#endif
+    return malloc(size);
+}
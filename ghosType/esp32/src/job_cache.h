@@ -0,0 +1,127 @@
+/**
+ * @file job_cache.h
+ * @brief 컴파일된 작업 캐시 (내용 해시 기반 LRU)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 최근 타이핑한 텍스트의 컴파일 결과를 PSRAM에 보관합니다.
+ * 포커스 이동 등으로 작업이 중간에 실패했을 때 클라이언트는 같은 페이로드를
+ * 다시 보내는 대신 해시만 보내 캐시 적중 여부를 묻고, 적중하면 전송·파싱·컴파일
+ * 없이 곧바로 다시 타이핑합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+/**
+ * @brief 원래 작업의 설정 (재생할 때 원래 작업과 같게 적용)
+ */
+struct CachedJobSettings {
+    uint8_t layout;           ///< 컴파일에 쓴 배열 (작업 JSON의 layout 반영)
+    int speed_cps;            ///< 작업 JSON의 speed_cps (-1: 지정 안 함)
+    int32_t progress_ms;      ///< 작업 JSON의 progress_ms (-1: 지정 안 함)
+};
+
+/**
+ * @brief 캐시 항목
+ */
+struct CachedJob {
+    uint32_t hash;            ///< 텍스트 해시 (FNV-1a 32비트)
+    uint32_t text_length;     ///< 텍스트 길이 (해시 충돌 방지용 보조 키)
+    uint8_t layout;           ///< 보낸 클라이언트의 CFG 배열 (조회 키, 배열이 다르면 다른 항목)
+    CachedJobSettings settings;  ///< 원래 작업의 설정
+    uint32_t source_bytes;    ///< 원래 수신 메시지 크기 (절약량 계산용)
+    KeyEvent* events;         ///< 컴파일된 이벤트 (PSRAM)
+    uint32_t event_count;     ///< 이벤트 개수
+    uint32_t last_used;       ///< 마지막 사용 순번 (LRU)
+};
+
+/**
+ * @brief 캐시 통계
+ */
+struct JobCacheStats {
+    uint32_t probes;          ///< 해시 조회 수
+    uint32_t hits;            ///< 적중 수
+    uint32_t misses;          ///< 실패 수
+    uint32_t bytes_saved;     ///< 캐시된 이벤트 열을 재생해 전송을 생략한 바이트 수
+    uint32_t evictions;       ///< 용량 부족으로 밀려난 항목 수
+};
+
+/**
+ * @brief 컴파일된 작업 LRU 캐시
+ *
+ * 동기화는 호출하는 쪽에서 담당합니다 (main.cpp의 queueMutex).
+ */
+class JobCache {
+public:
+    JobCache();
+
+    /**
+     * @brief 텍스트 해시 계산 (클라이언트와 동일한 FNV-1a 32비트)
+     * @param text 텍스트 (UTF-8)
+     * @param length 바이트 길이
+     * @return 해시값
+     */
+    static uint32_t hashText(const char* text, size_t length);
+
+    /**
+     * @brief 클라이언트의 해시 조회 처리
+     * @param hash 텍스트 해시
+     * @param text_length 텍스트 길이
+     * @param layout 클라이언트의 현재 CFG 배열
+     * @return true 적중 (곧바로 재생 가능), false 실패
+     *
+     * 적중 시 항목을 최근 사용으로 갱신합니다. 절약량은 fetch로 실제 재생할 때 기록합니다.
+     */
+    bool probe(uint32_t hash, uint32_t text_length, uint8_t layout);
+
+    /**
+     * @brief 캐시된 이벤트 열 복사
+     * @param hash 텍스트 해시
+     * @param text_length 텍스트 길이
+     * @param layout 클라이언트의 현재 CFG 배열
+     * @param[out] events 이벤트 열
+     * @param[out] settings 원래 작업의 설정
+     * @return true 성공 (절약량 기록), false 없음 (조회 이후 밀려난 경우)
+     */
+    bool fetch(uint32_t hash, uint32_t text_length, uint8_t layout, std::vector<KeyEvent>& events,
+               CachedJobSettings& settings);
+
+    /**
+     * @brief 컴파일 결과 저장
+     * @param hash 텍스트 해시
+     * @param text_length 텍스트 길이
+     * @param layout 보낸 클라이언트의 CFG 배열 (조회 키 - 작업 JSON의 layout과 관계없이 조회가 적중하도록)
+     * @param settings 원래 작업의 설정 (컴파일에 쓴 배열, 속도, 진행 알림 주기)
+     * @param source_bytes 원래 수신 메시지 크기
+     * @param events 컴파일된 이벤트 열
+     *
+     * 용량이 부족하면 가장 오래 쓰지 않은 항목부터 밀어냅니다.
+     * 같은 키의 항목이 다른 설정으로 컴파일되었으면 새 결과로 바꿉니다.
+     */
+    void store(uint32_t hash, uint32_t text_length, uint8_t layout, const CachedJobSettings& settings,
+               uint32_t source_bytes, const std::vector<KeyEvent>& events);
+
+    const JobCacheStats& stats() const { return cache_stats; }
+
+    /**
+     * @brief 캐시 상태를 JSON 객체 문자열로 변환
+     * @return 예: {"entries":3,"bytes":8120,"probes":5,"hits":4,"hit_rate":80,"saved":24576}
+     */
+    String statsJson() const;
+
+private:
+    CachedJob entries[JOB_CACHE_MAX_ENTRIES];  ///< 캐시 항목 (events == NULL이면 빈 칸)
+    size_t used_bytes;                         ///< 사용 중인 이벤트 바이트
+    uint32_t use_counter;                      ///< LRU 순번 카운터
+    JobCacheStats cache_stats;                 ///< 통계
+
+    CachedJob* find(uint32_t hash, uint32_t text_length, uint8_t layout);
+    CachedJob* leastRecentlyUsed();
+    void evict(CachedJob& entry);
+    static void* allocate(size_t size);
+};
@@ -0,0 +1,72 @@
+/**
+ * @file job_pipeline.cpp
+ * @brief 수신/컴파일/타이핑 단계 사이의 작업 전달 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "job_pipeline.h"
+
+JobPipeline::JobPipeline()
+    : queue(NULL), compile_task(NULL), compiled(0), last_compile_ms(0), max_compile_ms(0), last_gap_ms(0) {
+}
+
+void JobPipeline::initialize(TaskHandle_t task) {
+    queue = xQueueCreate(PIPELINE_DEPTH, sizeof(CompiledJob*));
+    compile_task = task;
+}
+
+bool JobPipeline::hasSpace() const {
+    return queue && uxQueueSpacesAvailable(queue) > 0;
+}
+
+void JobPipeline::submit(CompiledJob* job) {
+    compiled++;
+    last_compile_ms = job->compile_ms;
+    if (job->compile_ms > max_compile_ms) {
+        max_compile_ms = job->compile_ms;
+    }
+    xQueueSend(queue, &job, portMAX_DELAY);
+}
+
+CompiledJob* JobPipeline::take() {
+    CompiledJob* job = NULL;
+    if (!queue || xQueueReceive(queue, &job, 0) != pdTRUE) {
+        return NULL;
+    }
+    wake();  // 자리가 생겼으므로 다음 작업 컴파일
+    return job;
+}
+
+size_t JobPipeline::ready() const {
+    return queue ? uxQueueMessagesWaiting(queue) : 0;
+}
+
+void JobPipeline::wake() {
+    if (compile_task) {
+        xTaskNotifyGive(compile_task);
+    }
+}
+
+void JobPipeline::waitForWork(uint32_t timeout_ms) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+}
+
+void JobPipeline::recordGap(uint32_t gap_ms) {
+    last_gap_ms = gap_ms;
+}
+
+String JobPipeline::statsJson() const {
+    String json = "{\"ready\":";
+    json += (unsigned int)ready();
+    json += ",\"compiled\":";
+    json += compiled;
+    json += ",\"compile_ms\":";
+    json += last_compile_ms;
+    json += ",\"max_compile_ms\":";
+    json += max_compile_ms;
+    json += ",\"gap_ms\":";
+    json += last_gap_ms;
+    json += "}";
+    return json;
+}
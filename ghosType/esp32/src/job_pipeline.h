@@ -0,0 +1,121 @@
+/**
+ * @file job_pipeline.h
+ * @brief 수신/컴파일/타이핑 단계 사이의 작업 전달
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 작업 처리를 세 단계로 나눕니다.
+ * - 수신과 청크 재조립: 코어 0의 BLE 콜백 (벌크 레인에 추가)
+ * - 해석과 키 입력 컴파일: 코어 0의 컴파일 태스크 (BLE보다 낮은 우선순위)
+ * - HID 출력: 코어 1의 loop()
+ *
+ * 컴파일 단계는 완성된 작업을 길이가 정해진 큐(PIPELINE_DEPTH)에 넘기므로
+ * 작업 N을 타이핑하는 동안 작업 N+1의 해석과 컴파일이 끝나 있어
+ * 작업 사이에 해석/컴파일 시간이 끼지 않습니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+/**
+ * @brief 컴파일 결과
+ */
+enum CompiledJobStatus {
+    JOB_STATUS_TYPE = 0,    ///< 타이핑할 작업 (완료 시 OK:Typing completed 또는 ACK:<번호>)
+    JOB_STATUS_FAILED,      ///< 해석/조회 실패 - 타이핑 없이 reply만 전송 (ERR:...)
+    JOB_STATUS_NO_TYPING    ///< 타이핑이 없는 작업 (스니펫 등록 등) - reply만 전송
+};
+
+/**
+ * @brief 컴파일이 끝나 타이핑을 기다리는 작업
+ */
+struct CompiledJob {
+    std::vector<KeyEvent> events;  ///< 타이핑할 키 이벤트 (JOB_STATUS_TYPE이 아니면 비어 있음)
+    uint8_t status;                ///< CompiledJobStatus
+    String reply;                  ///< 완료 응답 대신 보낼 응답 (앞선 작업의 응답 뒤에 순서대로 전송)
+    int speed_cps;                 ///< 작업 JSON의 speed_cps (-1: 지정 안 함, 타이핑 시작 시 적용)
+    int32_t progress_ms;           ///< 작업 JSON의 progress_ms (-1: 지정 안 함)
+    bool chunk;                    ///< 청크 작업 (완료 응답이 ACK:<번호>)
+    uint32_t chunk_id;             ///< 청크 번호
+    bool stream;                   ///< 스트림 작업 (이벤트는 타이핑하면서 StreamIngest에서 꺼냄)
+    uint32_t compile_ms;           ///< 해석 + 컴파일 시간
+    uint8_t client;                ///< 작업을 보낸 클라이언트 (응답, 속도/진행 설정 기준)
+    uint8_t layout;                ///< 이 작업을 컴파일한 배열 (작업 JSON의 layout은 이 작업에만 적용)
+};
+
+/**
+ * @brief 단계 사이 작업 전달 클래스
+ *
+ * submit()/hasSpace()/waitForWork()는 컴파일 태스크, take()는 loop(),
+ * wake()는 어느 태스크에서나 호출합니다. 작업은 포인터로 전달되며
+ * take()로 받은 쪽이 delete합니다.
+ */
+class JobPipeline {
+public:
+    JobPipeline();
+
+    /**
+     * @brief 큐 생성 (setup에서 한 번)
+     * @param compile_task 깨울 컴파일 태스크
+     */
+    void initialize(TaskHandle_t compile_task);
+
+    /**
+     * @brief 컴파일된 작업을 넣을 자리가 있는지 확인
+     */
+    bool hasSpace() const;
+
+    /**
+     * @brief 컴파일된 작업 전달 (hasSpace()가 참일 때 호출)
+     * @param job 작업 (소유권 이전)
+     */
+    void submit(CompiledJob* job);
+
+    /**
+     * @brief 타이핑할 작업 꺼내기 (기다리지 않음)
+     * @return 작업 (없으면 NULL)
+     */
+    CompiledJob* take();
+
+    /**
+     * @brief 컴파일이 끝나 기다리는 작업 수
+     */
+    size_t ready() const;
+
+    /**
+     * @brief 컴파일 태스크 깨우기 (새 작업 수신, 큐에 자리 생김)
+     */
+    void wake();
+
+    /**
+     * @brief 컴파일 태스크에서 새 일이 생길 때까지 대기
+     * @param timeout_ms 최대 대기 시간
+     */
+    void waitForWork(uint32_t timeout_ms);
+
+    /**
+     * @brief 작업 사이 빈 시간 기록 (이전 작업 끝 → 다음 작업 시작)
+     */
+    void recordGap(uint32_t gap_ms);
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"ready":n,"compiled":n,"compile_ms":n,"max_compile_ms":n,"gap_ms":n}
+     */
+    String statsJson() const;
+
+private:
+    QueueHandle_t queue;
+    TaskHandle_t compile_task;
+    uint32_t compiled;
+    uint32_t last_compile_ms;
+    uint32_t max_compile_ms;
+    uint32_t last_gap_ms;
+};
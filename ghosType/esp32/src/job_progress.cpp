@@ -0,0 +1,198 @@
+/**
+ * @file job_progress.cpp
+ * @brief 타이핑 작업 진행률 및 예상 완료 시간 추적 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "job_progress.h"
+#include <stdio.h>
+#include <string.h>
+
+uint32_t typingKeyCostMs(uint8_t kind, int speed_cps) {
+    switch (kind) {
+        case KEY_EVENT_ENTER:
+            return ENTER_PRE_DELAY_MS + ENTER_HOLD_MS + ENTER_POST_DELAY_MS;
+        case KEY_EVENT_TAB:
+            return TAB_HOLD_MS + TAB_POST_DELAY_MS;
+        case KEY_EVENT_TOGGLE:
+            return HANENG_PRESS_DELAY_MS * 2 + HANENG_SETTLE_MS;
+        case KEY_EVENT_PARAM:
+            return 0;
+        default:
+            return speed_cps > 0 ? 1000 / speed_cps : 1000;
+    }
+}
+
+JobProgress::JobProgress()
+    : is_active(false), total_chars(0), typed_chars(0), untyped_events(0),
+      remaining_enter(0), remaining_tab(0), remaining_toggle(0), remaining_plain(0),
+      total_toggles(0), toggles_removed(0), report_interval_ms(0), next_report_at(0) {
+    memset(remaining_pairs, 0, sizeof(remaining_pairs));
+    memset(&last_event, 0, sizeof(last_event));
+    last_event.kind = KEY_EVENT_PARAM;
+}
+
+void JobProgress::begin(const KeyEvent* events, size_t count, uint32_t now_ms) {
+    is_active = true;
+    total_chars = 0;
+    typed_chars = 0;
+    untyped_events = count;
+    remaining_enter = 0;
+    remaining_tab = 0;
+    remaining_toggle = 0;
+    remaining_plain = 0;
+    memset(remaining_pairs, 0, sizeof(remaining_pairs));
+
+    // 이벤트 종류별, 조합 전환별 개수 집계 (작업당 한 번)
+    for (size_t i = 0; i < count; i++) {
+        total_chars += endsChar(events[i]) ? 1 : 0;
+        counterFor(events[i].kind)++;
+        size_t* pair = i + 1 < count ? pairFor(events[i], events[i + 1]) : NULL;
+        if (pair) {
+            (*pair)++;
+        }
+    }
+    if (count > 0) {
+        last_event = events[count - 1];
+    } else {
+        memset(&last_event, 0, sizeof(last_event));
+        last_event.kind = KEY_EVENT_PARAM;  // 일반 키가 아니면 다음 이벤트와 전환을 이루지 않음
+    }
+    total_toggles = remaining_toggle;
+    toggles_removed = 0;
+
+    next_report_at = now_ms + report_interval_ms;
+}
+
+void JobProgress::extend(const KeyEvent& event) {
+    // 앞 이벤트가 아직 타이핑되지 않았으면 타이핑 루프가 둘 사이의 간격을 알고 있음
+    size_t* pair = untyped_events > 0 ? pairFor(last_event, event) : NULL;
+    if (pair) {
+        (*pair)++;
+    }
+    last_event = event;
+    untyped_events++;
+    total_chars += endsChar(event) ? 1 : 0;
+    counterFor(event.kind)++;
+    if (event.kind == KEY_EVENT_TOGGLE) {
+        total_toggles++;
+    }
+}
+
+void JobProgress::advance(const KeyEvent& event, const KeyEvent* next) {
+    if (!is_active) {
+        return;
+    }
+
+    typed_chars += endsChar(event) ? 1 : 0;
+    if (untyped_events > 0) {
+        untyped_events--;
+    }
+    size_t& remaining = counterFor(event.kind);
+    if (remaining > 0) {
+        remaining--;
+    }
+    size_t* pair = next ? pairFor(event, *next) : NULL;
+    if (pair && *pair > 0) {
+        (*pair)--;
+    }
+}
+
+size_t* JobProgress::pairFor(const KeyEvent& current, const KeyEvent& next) {
+    // ImePacing::delayAfter와 같은 조건 - 일반 키 사이의 전환만 최소 간격 대상
+    if (current.kind != KEY_EVENT_CHAR || next.kind != KEY_EVENT_CHAR ||
+        current.role >= JAMO_ROLE_COUNT || next.role >= JAMO_ROLE_COUNT) {
+        return NULL;
+    }
+    return &remaining_pairs[current.role][next.role];
+}
+
+bool JobProgress::endsChar(const KeyEvent& event) {
+    // 한영 전환의 modifiers는 전환 플래그이므로 일반 키/엔터/탭만 확인
+    return event.kind <= KEY_EVENT_TAB && (event.modifiers & KEY_CHAR_END) != 0;
+}
+
+size_t& JobProgress::counterFor(uint8_t kind) {
+    switch (kind) {
+        case KEY_EVENT_ENTER:  return remaining_enter;
+        case KEY_EVENT_TAB:    return remaining_tab;
+        case KEY_EVENT_TOGGLE: return remaining_toggle;
+        default:               return remaining_plain;
+    }
+}
+
+void JobProgress::finish() {
+    is_active = false;
+    typed_chars = total_chars;
+    untyped_events = 0;
+    remaining_enter = 0;
+    remaining_tab = 0;
+    remaining_toggle = 0;
+    remaining_plain = 0;
+    memset(remaining_pairs, 0, sizeof(remaining_pairs));
+}
+
+void JobProgress::setInterval(uint32_t interval_ms) {
+    report_interval_ms = interval_ms;
+}
+
+bool JobProgress::reportDue(uint32_t now_ms) {
+    if (!is_active || report_interval_ms == 0) {
+        return false;
+    }
+    if ((int32_t)(now_ms - next_report_at) < 0) {
+        return false;
+    }
+
+    next_report_at = now_ms + report_interval_ms;
+    return true;
+}
+
+uint8_t JobProgress::percent() const {
+    if (total_chars == 0) {
+        return is_active ? 0 : 100;
+    }
+    uint32_t progress = (uint32_t)((typed_chars * 100) / total_chars);
+    return (uint8_t)MIN(progress, 100);
+}
+
+uint32_t JobProgress::etaMs(uint32_t base_us, const ImePacing& pacing, uint32_t barrier_ms) const {
+    if (!is_active) {
+        return 0;
+    }
+
+    // 일반 키 - 조합 전환 쌍은 타이핑 루프와 같이 기본 간격과 전환별 최소 간격 중 큰 값
+    uint64_t plain_us = 0;
+    size_t paired = 0;
+    for (uint8_t from = 0; from < JAMO_ROLE_COUNT; from++) {
+        for (uint8_t to = 0; to < JAMO_ROLE_COUNT; to++) {
+            size_t count = remaining_pairs[from][to];
+            if (count > 0) {
+                plain_us += (uint64_t)count * pacing.gapUs(from, to, base_us);
+                paired += count;
+            }
+        }
+    }
+    plain_us += (uint64_t)(remaining_plain > paired ? remaining_plain - paired : 0) * base_us;
+
+    // 적응형 모드의 동기화 장벽은 일반 키 SYNC_BARRIER_INTERVAL_KEYS개마다 한 번
+    uint64_t barriers_ms = (uint64_t)(remaining_plain / SYNC_BARRIER_INTERVAL_KEYS) * barrier_ms;
+
+    uint64_t eta = plain_us / 1000 + barriers_ms +
+                   remaining_enter * typingKeyCostMs(KEY_EVENT_ENTER, 0) +
+                   remaining_tab * typingKeyCostMs(KEY_EVENT_TAB, 0) +
+                   remaining_toggle * typingKeyCostMs(KEY_EVENT_TOGGLE, 0);
+    return (uint32_t)MIN(eta, (uint64_t)UINT32_MAX);
+}
+
+size_t JobProgress::formatReport(char* buffer, size_t size, uint32_t eta_ms, size_t queued) const {
+    int written = snprintf(buffer, size, "PRG:%u/%u;pct=%u;eta=%lu;q=%u",
+                           (unsigned)typed_chars, (unsigned)total_chars,
+                           (unsigned)percent(), (unsigned long)eta_ms,
+                           (unsigned)queued);
+    if (written < 0) {
+        return 0;
+    }
+    return (size_t)written < size ? (size_t)written : size - 1;
+}
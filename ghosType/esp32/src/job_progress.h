@@ -0,0 +1,150 @@
+/**
+ * @file job_progress.h
+ * @brief 타이핑 작업 진행률 및 예상 완료 시간 추적
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 진행 중인 타이핑 작업의 진행률과 남은 시간을 계산하고,
+ * 클라이언트가 정한 주기마다 한 번의 알림으로 묶어 보고합니다.
+ * 남은 시간은 타이핑 루프가 실제로 두는 지연(IME 조합 전환별 최소 간격, 동기화 장벽
+ * 대기 포함)을 더해 계산합니다.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+#include "keystroke_compiler.h"
+#include "ime_pacing.h"
+
+/**
+ * @brief 키 이벤트 하나를 타이핑하는 데 걸리는 시간 (타이핑 루프와 동일한 모델)
+ * @param kind 키 이벤트 종류 (KeyEventKind)
+ * @param speed_cps 현재 타이핑 속도
+ * @return 소요 시간 (밀리초)
+ */
+uint32_t typingKeyCostMs(uint8_t kind, int speed_cps);
+
+/**
+ * @brief 타이핑 작업 진행률 추적 클래스
+ *
+ * 진행률은 키 이벤트가 아니라 원문 글자 수로 셉니다 (KEY_CHAR_END가 붙은 이벤트 하나가 글자 하나).
+ * 이벤트 종류(엔터, 탭, 한영 전환, 일반)별 남은 개수와 연속한 일반 키의 조합 역할 쌍별
+ * 남은 개수만 유지하므로 속도나 간격 표가 바뀌어도 예상 완료 시간을 다시 훑지 않고 계산합니다.
+ */
+class JobProgress {
+public:
+    JobProgress();
+
+    /**
+     * @brief 새 작업 시작
+     * @param events 타이핑할 키 이벤트 열
+     * @param count 이벤트 개수
+     * @param now_ms 현재 시각
+     */
+    void begin(const KeyEvent* events, size_t count, uint32_t now_ms);
+
+    /**
+     * @brief 타이핑 중에 받은 이벤트를 전체 개수에 추가 (스트림 작업)
+     * @param event 추가된 이벤트
+     */
+    void extend(const KeyEvent& event);
+
+    /**
+     * @brief 키 이벤트 하나 타이핑 완료 기록
+     * @param event 타이핑한 이벤트
+     * @param next 다음 이벤트 (NULL: 아직 받지 않았거나 마지막 이벤트)
+     */
+    void advance(const KeyEvent& event, const KeyEvent* next);
+
+    /**
+     * @brief 작업 종료
+     */
+    void finish();
+
+    /**
+     * @brief 진행 알림 주기 설정
+     * @param interval_ms 알림 주기 (0: 알림 끄기)
+     */
+    void setInterval(uint32_t interval_ms);
+    uint32_t interval() const { return report_interval_ms; }
+
+    /**
+     * @brief 진행 알림을 보낼 시점인지 확인
+     * @param now_ms 현재 시각
+     * @return true 보낼 시점 (다음 주기로 갱신됨)
+     */
+    bool reportDue(uint32_t now_ms);
+
+    /**
+     * @brief 작업 시작 전에 제거한 한영 전환 수 기록
+     * @param removed 제거한 수
+     */
+    void setTogglesRemoved(size_t removed) { toggles_removed = removed; }
+
+    bool active() const { return is_active; }
+    size_t typedChars() const { return typed_chars; }
+    size_t totalChars() const { return total_chars; }
+    size_t toggles() const { return total_toggles; }
+    size_t togglesRemoved() const { return toggles_removed; }
+
+    /**
+     * @brief 진행률 계산
+     * @return 진행률 (0-100)
+     */
+    uint8_t percent() const;
+
+    /**
+     * @brief 남은 시간 계산
+     * @param base_us 현재 기본 키 간격 (마이크로초, 적응형 모드이면 학습한 간격)
+     * @param pacing 조합 전환별 최소 간격 표 (타이핑 루프와 같은 표)
+     * @param barrier_ms 동기화 장벽 한 번의 예상 대기 시간 (0: 장벽 없음)
+     * @return 예상 남은 시간 (밀리초)
+     */
+    uint32_t etaMs(uint32_t base_us, const ImePacing& pacing, uint32_t barrier_ms) const;
+
+    /**
+     * @brief 진행 알림 메시지 생성
+     * @param[out] buffer 출력 버퍼
+     * @param size 버퍼 크기
+     * @param eta_ms 예상 남은 시간 (etaMs 결과)
+     * @param queued 벌크 레인에서 대기 중인 작업 수
+     * @return 기록된 길이
+     *
+     * 형식: PRG:<typed_chars>/<total_chars>;pct=<0-100>;eta=<ms>;q=<queued>
+     */
+    size_t formatReport(char* buffer, size_t size, uint32_t eta_ms, size_t queued) const;
+
+private:
+    bool is_active;              ///< 작업 진행 여부
+    size_t total_chars;          ///< 전체 글자 수
+    size_t typed_chars;          ///< 타이핑된 글자 수
+    size_t untyped_events;       ///< 추가됐지만 아직 타이핑되지 않은 이벤트 수
+    size_t remaining_enter;      ///< 남은 엔터 수
+    size_t remaining_tab;        ///< 남은 탭 수
+    size_t remaining_toggle;     ///< 남은 한영 전환 수
+    size_t remaining_plain;      ///< 남은 일반 문자 수
+    size_t remaining_pairs[JAMO_ROLE_COUNT][JAMO_ROLE_COUNT];  ///< 남은 일반 키 → 일반 키 전환 수 (조합 역할 쌍별)
+    KeyEvent last_event;         ///< 마지막으로 추가된 이벤트 (스트림 작업의 전환 집계용)
+    size_t total_toggles;        ///< 작업의 한영 전환 수 (제거 후)
+    size_t toggles_removed;      ///< 최소화 단계에서 제거한 한영 전환 수
+    uint32_t report_interval_ms; ///< 알림 주기 (0: 끔)
+    uint32_t next_report_at;     ///< 다음 알림 시각
+
+    /**
+     * @brief 원문 글자 하나의 마지막 키인지 확인
+     */
+    static bool endsChar(const KeyEvent& event);
+
+    /**
+     * @brief 이벤트 종류에 해당하는 남은 개수 카운터
+     */
+    size_t& counterFor(uint8_t kind);
+
+    /**
+     * @brief 연속한 두 이벤트가 조합 전환별 간격의 대상이면 쌍 카운터 반환
+     * @return 대상이 아니면 NULL
+     */
+    size_t* pairFor(const KeyEvent& current, const KeyEvent& next);
+};
@@ -0,0 +1,121 @@
+/**
+ * @file key_pacer.cpp
+ * @brief 절대 시각 기준 키 간격 예약 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "key_pacer.h"
+#include <esp_timer.h>
+#include <string.h>
+
+static const uint32_t JITTER_BOUNDS_US[PACING_JITTER_BUCKETS - 1] = { PACING_JITTER_BOUNDS_US };
+
+KeyPacer::KeyPacer()
+    : anchored(false), deadline_us(0), wake_us(0), last_press_us(0), last_gap_us(0),
+      keys(0), resyncs(0), max_jitter_us(0), target_us(0), actual_us(0), job_target_us(0), job_actual_us(0) {
+    memset(histogram, 0, sizeof(histogram));
+}
+
+void KeyPacer::beginJob() {
+    job_target_us = 0;
+    job_actual_us = 0;
+}
+
+void KeyPacer::waitForSlot() {
+    int64_t now = esp_timer_get_time();
+    if (!anchored) {
+        anchored = true;
+        deadline_us = now;
+        last_press_us = now;
+        return;
+    }
+
+    // 틱 단위 delay()로 대부분 쉬고 마지막 PACING_SPIN_US만 마이크로초 대기
+    int64_t remaining = wake_us - now;
+    if (remaining > PACING_SPIN_US) {
+        uint32_t coarse_ms = (uint32_t)((remaining - PACING_SPIN_US) / 1000);
+        if (coarse_ms > 0) {
+            delay(coarse_ms);
+        }
+        remaining = wake_us - esp_timer_get_time();
+    }
+    if (remaining > 0) {
+        delayMicroseconds((uint32_t)remaining);
+    }
+
+    now = esp_timer_get_time();
+    if (now - deadline_us > PACING_MAX_LAG_US) {
+        // 장벽, 스트림 대기 등으로 크게 밀림 - 밀린 키를 몰아치지 않고 여기서 다시 시작
+        resyncs++;
+        deadline_us = now;
+        last_press_us = now;
+        return;
+    }
+
+    uint32_t jitter = (uint32_t)(now > wake_us ? now - wake_us : wake_us - now);
+    keys++;
+    if (jitter > max_jitter_us) {
+        max_jitter_us = jitter;
+    }
+    size_t bucket = 0;
+    while (bucket < PACING_JITTER_BUCKETS - 1 && jitter >= JITTER_BOUNDS_US[bucket]) {
+        bucket++;
+    }
+    histogram[bucket]++;
+
+    uint64_t interval = (uint64_t)(now - last_press_us);
+    target_us += last_gap_us;
+    actual_us += interval;
+    job_target_us += last_gap_us;
+    job_actual_us += interval;
+    last_press_us = now;
+}
+
+void KeyPacer::scheduleNext(uint32_t gap_us) {
+    if (gap_us == 0) {
+        anchored = false;
+        return;
+    }
+    // 마감은 간격을 그대로 누적하고, 늦은 만큼은 키마다 조금씩만 따라잡음
+    deadline_us += gap_us;
+    int64_t earliest = last_press_us + (int64_t)gap_us * PACING_MIN_INTERVAL_PCT / 100;
+    wake_us = deadline_us > earliest ? deadline_us : earliest;
+    last_gap_us = gap_us;
+}
+
+int32_t KeyPacer::driftPpm(uint64_t target, uint64_t actual) {
+    if (target == 0) {
+        return 0;
+    }
+    return (int32_t)(((int64_t)actual - (int64_t)target) * 1000000 / (int64_t)target);
+}
+
+String KeyPacer::statsJson() const {
+    String json = "{\"keys\":";
+    json += keys;
+    json += ",\"resyncs\":";
+    json += resyncs;
+    json += ",\"max_us\":";
+    json += max_jitter_us;
+    json += ",\"hist\":[";
+    for (size_t i = 0; i < PACING_JITTER_BUCKETS; i++) {
+        if (i > 0) {
+            json += ",";
+        }
+        json += histogram[i];
+    }
+    json += "],\"bounds_us\":[";
+    for (size_t i = 0; i < PACING_JITTER_BUCKETS - 1; i++) {
+        if (i > 0) {
+            json += ",";
+        }
+        json += JITTER_BOUNDS_US[i];
+    }
+    json += "],\"drift_ppm\":";
+    json += driftPpm(target_us, actual_us);
+    json += ",\"job_drift_ppm\":";
+    json += driftPpm(job_target_us, job_actual_us);
+    json += "}";
+    return json;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file key_pacer.h
+ * @brief 절대 시각 기준 키 간격 예약과 리포트 시각 오차 집계
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 예전에는 키 리포트를 보낸 뒤 delay(1000 / speed_cps)만큼 쉬었기 때문에 정수 나눗셈
+ * 오차(15 CPS → 66ms → 15.15 CPS)에 리포트 전송, 제어 레인 처리, 진행 알림 시간이
+ * 매 키마다 더해져 실제 속도가 설정보다 느려졌습니다.
+ * 여기서는 vTaskDelayUntil처럼 다음 키의 마감 시각을 esp_timer_get_time() 기준
+ * 마이크로초로 누적해 두고, 키를 보내기 직전에 그 시각까지만 기다립니다.
+ * 그 사이 처리에 쓴 시간은 기다림에서 빠지므로 오차가 쌓이지 않습니다.
+ *
+ * 조금 늦으면 다음 키들에서 나눠 따라잡고(간격의 PACING_MIN_INTERVAL_PCT 아래로는
+ * 줄이지 않음), 장벽이나 스트림 대기처럼 PACING_MAX_LAG_US 넘게 늦으면 밀린 키를
+ * 몰아치지 않도록 지금 시각으로 기준을 다시 잡습니다.
+ * 마감 대비 실제 리포트 시각의 차이를 히스토그램으로, 목표 대비 실제 간격 합을
+ * ppm으로 집계해 상태 보고에 포함합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * @brief 리포트 시각 오차 히스토그램 구간 수 (PACING_JITTER_BOUNDS_US + 초과 구간)
+ */
+constexpr size_t PACING_JITTER_BUCKETS = 8;
+
+/**
+ * @brief 키 간격 예약 클래스
+ */
+class KeyPacer {
+public:
+    KeyPacer();
+
+    /**
+     * @brief 작업 시작 - 작업별 속도 오차 집계를 새로 시작 (예약된 마감은 유지)
+     */
+    void beginJob();
+
+    /**
+     * @brief 다음 키의 마감 시각까지 대기 (키 리포트 직전 호출)
+     *
+     * 예약된 마감이 없으면 기다리지 않고 지금 시각을 기준으로 잡습니다.
+     */
+    void waitForSlot();
+
+    /**
+     * @brief 방금 보낸 키 다음의 마감 예약
+     * @param gap_us 다음 키까지의 간격 (0: 예약하지 않음 - 미러처럼 도착 즉시 입력)
+     */
+    void scheduleNext(uint32_t gap_us);
+
+    /**
+     * @brief 예약 해제 - 고정 지연이 있는 키(Enter, Tab, 한영 전환) 뒤에 호출
+     */
+    void interrupt() { anchored = false; }
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"keys":n,"resyncs":n,"max_us":n,"hist":[...],"bounds_us":[...],"drift_ppm":n,"job_drift_ppm":n}
+     */
+    String statsJson() const;
+
+private:
+    static int32_t driftPpm(uint64_t target_us, uint64_t actual_us);
+
+    bool anchored;            ///< 다음 키 마감이 예약되어 있음
+    int64_t deadline_us;      ///< 다음 키 마감 시각 - 간격을 그대로 누적 (esp_timer_get_time)
+    int64_t wake_us;          ///< 실제로 깨어날 시각 (따라잡는 중이면 최소 간격으로 제한한 마감)
+    int64_t last_press_us;    ///< 마지막 키 리포트 시각
+    uint32_t last_gap_us;     ///< 마지막으로 예약한 간격 (직전 마감 → 다음 마감)
+
+    uint32_t keys;            ///< 마감에 맞춰 보낸 키 수
+    uint32_t resyncs;         ///< 너무 늦어 기준을 다시 잡은 횟수
+    uint32_t max_jitter_us;
+    uint32_t histogram[PACING_JITTER_BUCKETS];
+    uint64_t target_us;       ///< 예약한 간격 합 (전체)
+    uint64_t actual_us;       ///< 실제 리포트 간격 합 (전체)
+    uint64_t job_target_us;   ///< 예약한 간격 합 (현재/마지막 작업)
+    uint64_t job_actual_us;   ///< 실제 리포트 간격 합 (현재/마지막 작업)
+};
@@ -0,0 +1,116 @@
+/**
+ * @file keymap.cpp
+ * @brief 호스트 키보드 배열별 문자 → HID 키 코드 표 구현
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 표는 컴파일 시점에 만들어지므로 배열 정의의 정확성도 아래 static_assert로
+ * 컴파일 시점에 검사합니다. 배열 문자열을 고치다 틀리면 빌드가 실패합니다.
+ * 호스트 배열로 되읽는 왕복 검사는 native 테스트(test/test_keymap)에 있습니다.
+ */
+
+#include "keymap.h"
+#include <string.h>
+
+namespace {
+
+using namespace keymap_detail;
+
+constexpr bool is(uint8_t layout, char32_t c, uint8_t usage, uint8_t modifiers) {
+    return KEYMAPS[layout].keys[c].usage == usage && KEYMAPS[layout].keys[c].modifiers == modifiers;
+}
+
+// 지정한 범위에서 입력할 수 없는 문자 수
+constexpr size_t countUnmapped(uint8_t layout, char32_t first, char32_t last) {
+    size_t count = 0;
+    for (char32_t c = first; c <= last; c++) {
+        if (KEYMAPS[layout].keys[c].usage == 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// 서로 다른 두 문자가 같은 키 조합을 쓰는지 검사
+constexpr bool hasCollision(uint8_t layout) {
+    const KeymapTable& table = KEYMAPS[layout];
+    for (size_t a = 0; a < KEYMAP_DIRECT_RANGE; a++) {
+        if (table.keys[a].usage == 0) {
+            continue;
+        }
+        for (size_t b = a + 1; b < KEYMAP_DIRECT_RANGE; b++) {
+            if (table.keys[a].usage == table.keys[b].usage &&
+                table.keys[a].modifiers == table.keys[b].modifiers) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+constexpr bool isJamo(char32_t jamo, uint8_t first, uint8_t first_mod, uint8_t second) {
+    return HANGUL_JAMO_KEYS.keys[jamo - HANGUL_JAMO_FIRST][0].usage == first &&
+           HANGUL_JAMO_KEYS.keys[jamo - HANGUL_JAMO_FIRST][0].modifiers == first_mod &&
+           HANGUL_JAMO_KEYS.keys[jamo - HANGUL_JAMO_FIRST][1].usage == second;
+}
+
+// 배열 문자열 길이 = 물리 키 수 (끝의 \0 제외)
+#define LAYOUT_STRING_OK(s) (ARRAY_SIZE(s) - 1 == PHYSICAL_KEY_COUNT)
+static_assert(LAYOUT_STRING_OK(US_BASE) && LAYOUT_STRING_OK(US_SHIFT),
+              "US layout strings must cover every physical key");
+static_assert(LAYOUT_STRING_OK(DE_BASE) && LAYOUT_STRING_OK(DE_SHIFT) && LAYOUT_STRING_OK(DE_ALTGR),
+              "DE layout strings must cover every physical key");
+static_assert(LAYOUT_STRING_OK(DVORAK_BASE) && LAYOUT_STRING_OK(DVORAK_SHIFT),
+              "Dvorak layout strings must cover every physical key");
+
+// 출력 가능한 ASCII는 모두 입력 가능 (독일어는 데드 키 ^ ` 제외)
+static_assert(countUnmapped(LAYOUT_US, 0x20, 0x7E) == 0, "US must cover printable ASCII");
+static_assert(countUnmapped(LAYOUT_KO_2SET, 0x20, 0x7E) == 0, "KO must cover printable ASCII");
+static_assert(countUnmapped(LAYOUT_DVORAK, 0x20, 0x7E) == 0, "Dvorak must cover printable ASCII");
+static_assert(countUnmapped(LAYOUT_DE, 0x20, 0x7E) == 2, "DE must cover printable ASCII except ^ and `");
+
+static_assert(!hasCollision(LAYOUT_US) && !hasCollision(LAYOUT_DE) && !hasCollision(LAYOUT_DVORAK),
+              "two characters must never share a key combination");
+
+// 대표 문자 확인
+static_assert(is(LAYOUT_US, U'a', 0x04, 0) && is(LAYOUT_US, U'A', 0x04, HID_MOD_LEFT_SHIFT) &&
+              is(LAYOUT_US, U'@', 0x1F, HID_MOD_LEFT_SHIFT) && is(LAYOUT_US, U'\n', 0x28, 0) &&
+              is(LAYOUT_US, U'~', 0x35, HID_MOD_LEFT_SHIFT) && is(LAYOUT_US, U' ', 0x2C, 0),
+              "US QWERTY keymap");
+static_assert(is(LAYOUT_DE, U'z', 0x1C, 0) && is(LAYOUT_DE, U'y', 0x1D, 0) &&
+              is(LAYOUT_DE, U'@', 0x14, HID_MOD_RIGHT_ALT) && is(LAYOUT_DE, U'ß', 0x2D, 0) &&
+              is(LAYOUT_DE, U'Ü', 0x2F, HID_MOD_LEFT_SHIFT) && is(LAYOUT_DE, U'|', 0x64, HID_MOD_RIGHT_ALT) &&
+              is(LAYOUT_DE, U'"', 0x1F, HID_MOD_LEFT_SHIFT),
+              "German QWERTZ keymap");
+static_assert(is(LAYOUT_DVORAK, U'a', 0x04, 0) && is(LAYOUT_DVORAK, U's', 0x33, 0) &&
+              is(LAYOUT_DVORAK, U'q', 0x1B, 0) && is(LAYOUT_DVORAK, U'Z', 0x38, HID_MOD_LEFT_SHIFT) &&
+              is(LAYOUT_DVORAK, U'-', 0x34, 0),
+              "Dvorak keymap");
+
+// 두벌식 자모 (ㄱ=r, ㄲ=Shift+r, ㅘ=h+k, ㄺ=f+r, ㅣ=l)
+static_assert(isJamo(U'ㄱ', 0x15, 0, 0) && isJamo(U'ㄲ', 0x15, HID_MOD_LEFT_SHIFT, 0) &&
+              isJamo(U'ㅘ', 0x0B, 0, 0x0E) && isJamo(U'ㄺ', 0x09, 0, 0x15) &&
+              isJamo(U'ㅣ', 0x0F, 0, 0) && isJamo(U'ㅒ', 0x12, HID_MOD_LEFT_SHIFT, 0),
+              "Korean 2-set jamo keymap");
+
+} // namespace
+
+bool Keymap::fromName(const char* name, uint8_t& layout) {
+    for (uint8_t i = 0; i < LAYOUT_COUNT; i++) {
+        if (strcmp(name, Keymap::name(i)) == 0) {
+            layout = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* Keymap::name(uint8_t layout) {
+    switch (layout) {
+        case LAYOUT_US:      return "us";
+        case LAYOUT_KO_2SET: return "ko";
+        case LAYOUT_DE:      return "de";
+        case LAYOUT_DVORAK:  return "dvorak";
+        default:             return "unknown";
+    }
+}
@@ -0,0 +1,200 @@
+/**
+ * @file keymap.h
+ * @brief 호스트 키보드 배열별 문자 → HID 키 코드 표
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 호스트 OS에 설정된 키보드 배열에 맞춰 각 문자를 어떤 물리 키(HID 사용 코드)와
+ * 수정키 조합으로 눌러야 하는지를 컴파일 시점에 표로 만듭니다.
+ * U+0000~U+00FF는 배열별 표에서 인덱스 한 번으로 찾고,
+ * 두벌식 한글 자모(U+3131~U+3163)는 별도의 자모 표에서 찾습니다.
+ *
+ * 각 배열은 물리 키 순서대로 적은 기본/Shift/AltGr 문자열로 정의하므로
+ * 배열을 추가할 때는 문자열 세 개만 작성하면 됩니다.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+
+// HID 수정키 비트 (키보드 리포트 첫 바이트)
+#define HID_MOD_LEFT_SHIFT 0x02
+#define HID_MOD_RIGHT_ALT 0x40       // AltGr
+
+/**
+ * @brief 호스트 키보드 배열
+ */
+enum KeyboardLayout {
+    LAYOUT_US = 0,            ///< 미국식 QWERTY
+    LAYOUT_KO_2SET,           ///< 한국어 두벌식 (영문은 US와 동일)
+    LAYOUT_DE,                ///< 독일어 QWERTZ
+    LAYOUT_DVORAK,            ///< 미국식 Dvorak
+    LAYOUT_COUNT
+};
+
+/**
+ * @brief 문자 하나를 입력하는 키 조합
+ */
+struct KeyStroke {
+    uint8_t usage;            ///< HID 사용 코드 (0: 이 배열로 입력할 수 없는 문자)
+    uint8_t modifiers;        ///< HID 수정키 비트
+};
+
+// 인덱스 한 번으로 찾는 코드 포인트 범위 (U+0000~U+00FF)
+constexpr size_t KEYMAP_DIRECT_RANGE = 256;
+
+// 한글 호환 자모 범위 (ㄱ U+3131 ~ ㅣ U+3163)
+constexpr uint32_t HANGUL_JAMO_FIRST = 0x3131;
+constexpr size_t HANGUL_JAMO_COUNT = 51;
+
+/**
+ * @brief 배열 하나의 문자 → 키 조합 표
+ */
+struct KeymapTable {
+    KeyStroke keys[KEYMAP_DIRECT_RANGE];
+};
+
+/**
+ * @brief 두벌식 자모 → 키 조합 표 (겹자음/겹모음은 두 키)
+ */
+struct JamoTable {
+    KeyStroke keys[HANGUL_JAMO_COUNT][2];
+};
+
+namespace keymap_detail {
+
+// 물리 키 목록 (US 배열 기준 HID 사용 코드) - 아래 배열 문자열과 같은 순서
+constexpr uint8_t PHYSICAL_KEYS[] = {
+    // A~Z
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    // 1~0
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    // Space
+    0x2C,
+    // - = [ ] \ (ISO #) ; ' ` , . /
+    0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    // ISO 추가 키 (Z 왼쪽)
+    0x64
+};
+constexpr size_t PHYSICAL_KEY_COUNT = sizeof(PHYSICAL_KEYS);
+
+// 배열 정의 - 물리 키마다 한 글자, \0은 해당 조합에 문자 없음 (데드 키 포함)
+constexpr char32_t US_BASE[] =
+    U"abcdefghijklmnopqrstuvwxyz" U"1234567890" U" " U"-=[]\\\0;'`,./" U"\0";
+constexpr char32_t US_SHIFT[] =
+    U"ABCDEFGHIJKLMNOPQRSTUVWXYZ" U"!@#$%^&*()" U"\0" U"_+{}|\0:\"~<>?" U"\0";
+
+constexpr char32_t DE_BASE[] =
+    U"abcdefghijklmnopqrstuvwxzy" U"1234567890" U" " U"ß\0ü+\0#öä\0,.-" U"<";
+constexpr char32_t DE_SHIFT[] =
+    U"ABCDEFGHIJKLMNOPQRSTUVWXZY" U"!\"§$%&/()=" U"\0" U"?\0Ü*\0'ÖÄ°;:_" U">";
+constexpr char32_t DE_ALTGR[] =
+    U"\0\0\0\0\0\0\0\0\0\0\0\0µ\0\0\0@\0\0\0\0\0\0\0\0\0" U"\0²³\0\0\0{[]}" U"\0"
+    U"\\\0\0~\0\0\0\0\0\0\0\0" U"|";
+
+constexpr char32_t DVORAK_BASE[] =
+    U"axje.uidchtnmbrl'poygk,qf;" U"1234567890" U" " U"[]/=\\\0s-`wvz" U"\0";
+constexpr char32_t DVORAK_SHIFT[] =
+    U"AXJE>UIDCHTNMBRL\"POYGK<QF:" U"!@#$%^&*()" U"\0" U"{}?+|\0S_~WVZ" U"\0";
+
+// 두벌식 자모별 영문 키 (ㄱ~ㅎ, ㅏ~ㅣ 순서)
+constexpr const char* JAMO_KEYS[HANGUL_JAMO_COUNT] = {
+    "r", "R", "rt", "s", "sw", "sg", "e", "E", "f", "fr", "fa", "fq", "ft", "fx", "fv", "fg",
+    "a", "q", "Q", "qt", "t", "T", "d", "w", "W", "c", "z", "x", "v", "g",
+    "k", "o", "i", "O", "j", "p", "u", "P", "h", "hk", "ho", "hl", "y", "n", "nj", "np", "nl",
+    "b", "m", "ml", "l"
+};
+
+constexpr void place(KeymapTable& table, char32_t c, uint8_t usage, uint8_t modifiers) {
+    // 같은 문자가 여러 조합에 있으면 수정키가 적은 앞쪽 조합을 사용
+    if (c != 0 && c < KEYMAP_DIRECT_RANGE && table.keys[c].usage == 0) {
+        table.keys[c].usage = usage;
+        table.keys[c].modifiers = modifiers;
+    }
+}
+
+constexpr KeymapTable buildKeymap(const char32_t* base, const char32_t* shift,
+                                  const char32_t* altgr) {
+    KeymapTable table = {};
+    // 배열과 무관한 제어 키
+    place(table, U'\n', 0x28, 0);
+    place(table, U'\b', 0x2A, 0);
+    place(table, U'\t', 0x2B, 0);
+    for (size_t i = 0; i < PHYSICAL_KEY_COUNT; i++) {
+        place(table, base[i], PHYSICAL_KEYS[i], 0);
+    }
+    for (size_t i = 0; i < PHYSICAL_KEY_COUNT; i++) {
+        place(table, shift[i], PHYSICAL_KEYS[i], HID_MOD_LEFT_SHIFT);
+    }
+    for (size_t i = 0; altgr && i < PHYSICAL_KEY_COUNT; i++) {
+        place(table, altgr[i], PHYSICAL_KEYS[i], HID_MOD_RIGHT_ALT);
+    }
+    return table;
+}
+
+constexpr JamoTable buildJamoTable(const KeymapTable& latin) {
+    JamoTable table = {};
+    for (size_t i = 0; i < HANGUL_JAMO_COUNT; i++) {
+        for (size_t k = 0; k < 2 && JAMO_KEYS[i][k] != '\0'; k++) {
+            table.keys[i][k] = latin.keys[(uint8_t)JAMO_KEYS[i][k]];
+        }
+    }
+    return table;
+}
+
+} // namespace keymap_detail
+
+// 배열별 표 (KeyboardLayout 순서)
+inline constexpr KeymapTable KEYMAPS[LAYOUT_COUNT] = {
+    keymap_detail::buildKeymap(keymap_detail::US_BASE, keymap_detail::US_SHIFT, nullptr),
+    keymap_detail::buildKeymap(keymap_detail::US_BASE, keymap_detail::US_SHIFT, nullptr),
+    keymap_detail::buildKeymap(keymap_detail::DE_BASE, keymap_detail::DE_SHIFT, keymap_detail::DE_ALTGR),
+    keymap_detail::buildKeymap(keymap_detail::DVORAK_BASE, keymap_detail::DVORAK_SHIFT, nullptr)
+};
+
+// 두벌식 자모 표 (한국어 배열의 영문 자판 위치 기준)
+inline constexpr JamoTable HANGUL_JAMO_KEYS = keymap_detail::buildJamoTable(KEYMAPS[LAYOUT_KO_2SET]);
+
+/**
+ * @brief 키보드 배열 유틸리티 클래스
+ */
+class Keymap {
+public:
+    /**
+     * @brief U+0000~U+00FF 문자의 키 조합 조회 (인덱스 한 번)
+     * @param layout KeyboardLayout
+     * @param code_point 코드 포인트 (KEYMAP_DIRECT_RANGE 미만)
+     * @return 키 조합 (usage 0: 입력 불가)
+     */
+    static inline KeyStroke lookup(uint8_t layout, uint32_t code_point) {
+        return KEYMAPS[layout].keys[code_point];
+    }
+
+    /**
+     * @brief 한글 호환 자모의 키 조합 조회
+     * @param code_point 코드 포인트
+     * @return 키 두 개 (두 번째 usage 0: 단일 키), 자모가 아니면 NULL
+     */
+    static inline const KeyStroke* lookupJamo(uint32_t code_point) {
+        uint32_t index = code_point - HANGUL_JAMO_FIRST;
+        return index < HANGUL_JAMO_COUNT ? HANGUL_JAMO_KEYS.keys[index] : NULL;
+    }
+
+    /**
+     * @brief 배열 이름으로 배열 찾기
+     * @param name "us", "ko", "de", "dvorak"
+     * @param[out] layout 찾은 배열
+     * @return true 찾음
+     */
+    static bool fromName(const char* name, uint8_t& layout);
+
+    /**
+     * @brief 배열 이름
+     * @param layout KeyboardLayout
+     * @return 이름 (상태 보고용)
+     */
+    static const char* name(uint8_t layout);
+};
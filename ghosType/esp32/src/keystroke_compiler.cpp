@@ -0,0 +1,279 @@
+/**
+ * @file keystroke_compiler.cpp
+ * @brief 텍스트를 키 입력 이벤트 열로 변환하는 컴파일러 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "keystroke_compiler.h"
+#include <string.h>
+
+// 문자가 요구하는 IME 모드 - 숫자, 공백, 문장 부호는 두 모드에서 똑같이 입력되므로 무관
+static uint8_t imeModeFor(uint32_t code_point) {
+    if (Hangul::isSyllable(code_point) || Hangul::isJamo(code_point)) {
+        return IME_MODE_KOREAN;
+    }
+    if ((code_point >= 'a' && code_point <= 'z') || (code_point >= 'A' && code_point <= 'Z')) {
+        return IME_MODE_ENGLISH;
+    }
+    return IME_MODE_UNKNOWN;
+}
+
+// IME 모드와 관계없이 같은 결과를 내는 이벤트인지 (글자 키 A~Z만 모드에 따라 달라짐)
+static bool isModeNeutral(const KeyEvent& event) {
+    switch (event.kind) {
+        case KEY_EVENT_ENTER:
+        case KEY_EVENT_TAB:
+            return true;
+        case KEY_EVENT_TOGGLE:
+            // 조건부 전환은 호스트가 이미 그 모드이면 입력되지 않으므로 구간을 나누지 않음
+            return (event.modifiers & KEY_TOGGLE_CONDITIONAL) != 0;
+        case KEY_EVENT_CHAR:
+            return event.code < 0x04 || event.code > 0x1D;
+        default:
+            return false;  // 한영 전환, 값을 모르는 매개변수 자리
+    }
+}
+
+size_t KeystrokeCompiler::compile(const char* text, size_t length, std::vector<KeyEvent>& out,
+                                  uint8_t layout, bool allow_params, CompileContext* context) {
+    const size_t marker_length = strlen(TOGGLE_MARKER);
+    size_t before = out.size();
+    out.reserve(before + length);
+
+    // 토글 마커 없이 한글이 섞여 오면 IME 모드를 추적해 한영 전환을 자동 삽입
+    // (마커가 있는 텍스트는 클라이언트 전처리를 그대로 따름)
+    bool track_mode = layout == LAYOUT_KO_2SET && !containsMarker(text, length);
+    uint8_t mode = context ? context->mode : (uint8_t)IME_MODE_UNKNOWN;
+    // 바로 앞에 입력한 완성형 음절 (초성이 앞 받침으로 붙는지 판단용, 0: 없음)
+    uint32_t previous_syllable = context ? context->previous_syllable : 0;
+
+    size_t i = 0;
+    while (i < length) {
+        unsigned char c = (unsigned char)text[i];
+        KeyEvent event = { KEY_EVENT_CHAR, 0, 0, JAMO_ROLE_NONE };
+        uint32_t syllable = previous_syllable;
+        previous_syllable = 0;
+
+        if (c == CHAR_NEWLINE || c == CHAR_CARRIAGE_RETURN) {
+            event.kind = KEY_EVENT_ENTER;
+            event.modifiers = KEY_CHAR_END;
+            out.push_back(event);
+            i++;
+            continue;
+        }
+        if (c == CHAR_TAB) {
+            event.kind = KEY_EVENT_TAB;
+            event.modifiers = KEY_CHAR_END;
+            out.push_back(event);
+            i++;
+            continue;
+        }
+        if (c >= 0x80 && length - i >= marker_length &&
+            memcmp(text + i, TOGGLE_MARKER, marker_length) == 0) {
+            event.kind = KEY_EVENT_TOGGLE;
+            out.push_back(event);
+            i += marker_length;
+            continue;
+        }
+        if (allow_params && c == '{' && i + 2 < length &&
+            text[i + 1] >= '0' && text[i + 1] <= '9' && text[i + 2] == '}') {
+            event.kind = KEY_EVENT_PARAM;
+            event.code = (uint8_t)(text[i + 1] - '0');
+            out.push_back(event);
+            i += 3;
+            continue;
+        }
+
+        uint32_t code_point = decodeUtf8(text, length, i);
+        KeyStroke strokes[HANGUL_MAX_SYLLABLE_KEYS];
+        uint8_t roles[HANGUL_MAX_SYLLABLE_KEYS];
+        size_t count = strokesFor(code_point, layout, strokes, roles);
+        if (count == 0) {
+            continue;  // 이 배열로 입력할 수 없는 문자
+        }
+        if (layout == LAYOUT_KO_2SET && Hangul::isSyllable(code_point)) {
+            if (syllable != 0 && Hangul::carriesChoseong(syllable, code_point)) {
+                roles[0] = JAMO_ROLE_CHOSEONG_CARRY;
+            }
+            previous_syllable = code_point;
+        }
+
+        if (track_mode) {
+            uint8_t wanted = imeModeFor(code_point);
+            if (wanted != IME_MODE_UNKNOWN && mode != wanted) {
+                // 첫 모드는 호스트의 현재 모드로 가정 (클라이언트 전처리기와 동일)하되,
+                // 호스트 LED로 모드를 알면 다를 때만 전환하도록 조건부 전환을 넣음
+                // 중립 문자는 모드를 바꾸지 않으므로 앞뒤 구간에 자연스럽게 합쳐짐
+                uint8_t flags = mode == IME_MODE_UNKNOWN ? KEY_TOGGLE_CONDITIONAL : 0;
+                KeyEvent toggle = { KEY_EVENT_TOGGLE, wanted, flags, JAMO_ROLE_NONE };
+                out.push_back(toggle);
+                mode = wanted;
+            }
+        }
+
+        for (size_t k = 0; k < count; k++) {
+            event.code = strokes[k].usage;
+            event.modifiers = strokes[k].modifiers;
+            event.role = roles[k];
+            out.push_back(event);
+        }
+        out.back().modifiers |= KEY_CHAR_END;
+    }
+
+    if (context) {
+        context->mode = mode;
+        context->previous_syllable = previous_syllable;
+    }
+    return out.size() - before;
+}
+
+size_t KeystrokeCompiler::strokesFor(uint32_t code_point, uint8_t layout, KeyStroke* strokes,
+                                     uint8_t* roles) {
+    if (code_point < KEYMAP_DIRECT_RANGE) {
+        // 배열 표에서 인덱스 한 번으로 키 조합 조회
+        strokes[0] = Keymap::lookup(layout, code_point);
+        roles[0] = JAMO_ROLE_NONE;
+        return strokes[0].usage != 0 ? 1 : 0;
+    }
+    if (layout != LAYOUT_KO_2SET) {
+        return 0;
+    }
+    if (Hangul::isSyllable(code_point)) {
+        // 완성형 음절 - 초성/중성/종성 키
+        return Hangul::syllableKeys(code_point, strokes, roles);
+    }
+
+    // 호환 자모 - 겹자음/겹모음은 두 키 (ㅏ U+314F부터 모음)
+    const KeyStroke* jamo = Keymap::lookupJamo(code_point);
+    bool vowel = code_point >= 0x314F;
+    size_t count = 0;
+    for (size_t k = 0; jamo && k < 2 && jamo[k].usage != 0; k++) {
+        roles[count] = vowel ? (k == 0 ? JAMO_ROLE_JUNGSEONG : JAMO_ROLE_JUNGSEONG_COMPOUND)
+                             : (k == 0 ? JAMO_ROLE_CHOSEONG : JAMO_ROLE_JONGSEONG_COMPOUND);
+        strokes[count++] = jamo[k];
+    }
+    return count;
+}
+
+bool KeystrokeCompiler::isTypeable(uint32_t code_point, uint8_t layout) {
+    if (code_point == CHAR_CARRIAGE_RETURN || code_point == CHAR_NEWLINE || code_point == CHAR_TAB) {
+        return true;
+    }
+    KeyStroke strokes[HANGUL_MAX_SYLLABLE_KEYS];
+    uint8_t roles[HANGUL_MAX_SYLLABLE_KEYS];
+    return strokesFor(code_point, layout, strokes, roles) > 0;
+}
+
+bool KeystrokeCompiler::containsMarker(const char* text, size_t length) {
+    const size_t marker_length = strlen(TOGGLE_MARKER);
+    for (size_t i = 0; i + marker_length <= length; i++) {
+        if (text[i] == TOGGLE_MARKER[0] && memcmp(text + i, TOGGLE_MARKER, marker_length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t KeystrokeCompiler::decodeUtf8(const char* text, size_t length, size_t& i) {
+    const uint8_t* bytes = (const uint8_t*)text;
+    uint8_t lead = bytes[i];
+    size_t extra;
+    uint32_t code_point;
+
+    if (lead < 0x80) {
+        i++;
+        return lead;
+    } else if ((lead & 0xE0) == 0xC0) {
+        extra = 1;
+        code_point = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2;
+        code_point = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3;
+        code_point = lead & 0x07;
+    } else {
+        i++;
+        return 0xFFFFFFFF;
+    }
+
+    if (i + extra >= length) {
+        i++;  // 잘린 문자
+        return 0xFFFFFFFF;
+    }
+    for (size_t k = 1; k <= extra; k++) {
+        if ((bytes[i + k] & 0xC0) != 0x80) {
+            i++;
+            return 0xFFFFFFFF;
+        }
+        code_point = (code_point << 6) | (bytes[i + k] & 0x3F);
+    }
+
+    i += extra + 1;
+    return code_point;
+}
+
+size_t KeystrokeCompiler::minimizeToggles(std::vector<KeyEvent>& events) {
+    std::vector<size_t> kept;          // 남겨 둔 한영 전환 위치
+    std::vector<bool> neutral_before;  // kept[k] 직전 구간이 중립 문자뿐인지 (제거 시 복원용)
+    std::vector<bool> removed(events.size(), false);
+    bool neutral = true;               // 마지막으로 남긴 전환 이후 구간이 중립 문자뿐인지
+    size_t removed_count = 0;
+
+    for (size_t i = 0; i < events.size(); i++) {
+        if (events[i].kind != KEY_EVENT_TOGGLE || (events[i].modifiers & KEY_TOGGLE_CONDITIONAL)) {
+            neutral = neutral && isModeNeutral(events[i]);
+            continue;
+        }
+        if (!kept.empty() && neutral) {
+            // 두 전환 사이가 중립 문자뿐이면 두 전환 모두 불필요 - 앞 구간과 합침
+            removed[kept.back()] = true;
+            removed[i] = true;
+            removed_count += 2;
+            neutral = neutral_before.back();
+            kept.pop_back();
+            neutral_before.pop_back();
+        } else {
+            kept.push_back(i);
+            neutral_before.push_back(neutral);
+            neutral = true;
+        }
+    }
+
+    if (removed_count > 0) {
+        size_t write = 0;
+        for (size_t i = 0; i < events.size(); i++) {
+            if (!removed[i]) {
+                events[write++] = events[i];
+            }
+        }
+        events.resize(write);
+    }
+    return removed_count;
+}
+
+void KeystrokeCompiler::expandParams(const std::vector<KeyEvent>& templ,
+                                     const std::vector<KeyEvent>* params, size_t param_count,
+                                     std::vector<KeyEvent>& out) {
+    out.reserve(out.size() + templ.size());
+    for (size_t i = 0; i < templ.size(); i++) {
+        const KeyEvent& event = templ[i];
+        if (event.kind != KEY_EVENT_PARAM) {
+            out.push_back(event);
+        } else if (event.code < param_count) {
+            const std::vector<KeyEvent>& value = params[event.code];
+            out.insert(out.end(), value.begin(), value.end());
+        }
+    }
+}
+
+uint8_t KeystrokeCompiler::countParams(const std::vector<KeyEvent>& events) {
+    uint8_t count = 0;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (events[i].kind == KEY_EVENT_PARAM && events[i].code + 1 > count) {
+            count = events[i].code + 1;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file keystroke_compiler.h
+ * @brief 텍스트를 키 입력 이벤트 열로 변환하는 컴파일러
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 수신된 텍스트를 타이핑 루프가 그대로 출력할 수 있는 키 이벤트 열로 변환합니다.
+ * 엔터/탭, 한영 토글 마커, 스니펫 매개변수 자리를 컴파일 시점에 해석하고
+ * 일반 문자는 호스트 키보드 배열 표(keymap.h)에서 HID 키 코드로 바꿔 두므로
+ * 컴파일된 결과는 저장해 두었다가 다시 파싱하지 않고 재생할 수 있습니다.
+ * 한글 키에는 음절 조합에서의 역할(JamoRole)을 함께 기록해 타이핑 루프가
+ * IME가 놓치기 쉬운 키 전환에서만 간격을 늘릴 수 있게 합니다 (ime_pacing.h).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "config.h"
+#include "keymap.h"
+#include "hangul.h"
+
+/**
+ * @brief 키 이벤트 종류
+ */
+enum KeyEventKind {
+    KEY_EVENT_CHAR = 0,     ///< 일반 키 (code: HID 사용 코드, modifiers: 수정키)
+    KEY_EVENT_ENTER,        ///< 엔터키
+    KEY_EVENT_TAB,          ///< 탭키
+    KEY_EVENT_TOGGLE,       ///< 한영 전환 (Alt+Shift, code: 전환 후 ImeMode, modifiers: KEY_TOGGLE_CONDITIONAL)
+    KEY_EVENT_PARAM         ///< 스니펫 매개변수 자리 (code: 매개변수 번호)
+};
+
+/**
+ * @brief 두벌식 호스트의 IME 입력 모드
+ */
+enum ImeMode {
+    IME_MODE_UNKNOWN = 0,     ///< 모름 / 모드와 무관한 문자 (토글 마커로 들어온 전환)
+    IME_MODE_ENGLISH,
+    IME_MODE_KOREAN
+};
+
+// 한영 전환 이벤트 플래그 - 호스트 모드를 알고 있고 code와 다를 때만 입력
+// (자동 전환에서 첫 구간 앞에 넣는 전환, 모드를 모르면 입력하지 않음)
+constexpr uint8_t KEY_TOGGLE_CONDITIONAL = 0x01;
+
+// 원문 글자 하나의 마지막 키 표시 - 일반 키/엔터/탭의 modifiers에 붙음 (진행률은 이 키로 글자 수를 셈)
+// 일반 키는 배열 표가 쓰지 않는 오른쪽 GUI 비트를 빌리므로 HID 리포트에서는 빼고 보냄 (HostSync::modifiersFor)
+constexpr uint8_t KEY_CHAR_END = 0x80;
+
+/**
+ * @brief 컴파일된 키 이벤트 (4바이트, 저장 형식과 동일)
+ */
+struct KeyEvent {
+    uint8_t kind;             ///< KeyEventKind
+    uint8_t code;             ///< 종류별 값
+    uint8_t modifiers;        ///< HID 수정키 비트 (일반 키) | KEY_CHAR_END, 한영 전환 플래그
+    uint8_t role;             ///< 한글 조합 역할 JamoRole (일반 키만 사용)
+};
+
+/**
+ * @brief 여러 조각으로 나뉘어 오는 텍스트를 이어서 컴파일할 때 유지하는 상태
+ *
+ * 라이브 미러처럼 글자 하나씩 따로 컴파일해도 한영 모드와 앞 음절이 이어지게 합니다.
+ */
+struct CompileContext {
+    uint8_t mode;               ///< 마지막으로 입력한 ImeMode (IME_MODE_UNKNOWN: 아직 없음)
+    uint32_t previous_syllable; ///< 마지막으로 입력한 완성형 음절 (0: 없음)
+};
+
+/**
+ * @brief 키 입력 컴파일러 클래스
+ */
+class KeystrokeCompiler {
+public:
+    /**
+     * @brief 텍스트 컴파일
+     * @param text 입력 텍스트 (UTF-8)
+     * @param length 바이트 길이
+     * @param[out] out 이벤트를 덧붙일 목록
+     * @param layout 호스트 키보드 배열 (KeyboardLayout)
+     * @param allow_params true이면 {0}~{9}를 매개변수 자리로 변환
+     * @param[in,out] context 앞 조각에서 이어지는 상태 (NULL: 독립된 텍스트)
+     * @return 추가된 이벤트 수
+     *
+     * '\n', '\r'은 엔터, '\t'는 탭, TOGGLE_MARKER는 한영 전환으로 변환합니다.
+     * 그 외 문자는 배열 표에서 찾은 키 조합이 되고, 두벌식에서는 완성형 음절과
+     * 호환 자모를 두벌식 키로 분해하고 키마다 조합 역할을 기록합니다 (hangul.h).
+     * 앞 음절의 받침으로 먼저 붙는 초성은 JAMO_ROLE_CHOSEONG_CARRY가 됩니다. 토글 마커가 없는 텍스트는
+     * 한글과 영문 사이에 한영 전환을 자동으로 넣고 전환 후 모드를 code에 기록합니다.
+     * 첫 구간 앞에는 호스트 모드가 다를 때만 입력하는 조건부 전환을 넣습니다.
+     * 배열로 입력할 수 없는 문자와 잘못된 UTF-8 바이트는 건너뜁니다.
+     * 입력되는 문자마다 마지막 키에 KEY_CHAR_END를 붙입니다 (한영 전환, 매개변수 자리 제외).
+     */
+    static size_t compile(const char* text, size_t length, std::vector<KeyEvent>& out,
+                          uint8_t layout, bool allow_params = false,
+                          CompileContext* context = nullptr);
+
+    /**
+     * @brief 불필요한 한영 전환 제거
+     * @param[in,out] events 이벤트 열
+     * @return 제거한 한영 전환 수
+     *
+     * 두 한영 전환 사이가 숫자, 공백, 문장 부호처럼 IME 모드와 관계없이 같은 결과를 내는
+     * 이벤트뿐이면 두 전환을 모두 지우고 그 구간을 앞 구간에 합칩니다.
+     * 클라이언트가 보낸 토글 마커와 자동 삽입된 전환 모두에 적용됩니다.
+     */
+    static size_t minimizeToggles(std::vector<KeyEvent>& events);
+
+    /**
+     * @brief 매개변수 자리를 실제 값으로 치환
+     * @param templ 매개변수 자리를 포함한 이벤트 열
+     * @param params 매개변수별 컴파일된 이벤트 열
+     * @param param_count 매개변수 개수
+     * @param[out] out 치환 결과
+     *
+     * 값이 주어지지 않은 매개변수 자리는 빈 문자열로 처리합니다.
+     */
+    static void expandParams(const std::vector<KeyEvent>& templ,
+                             const std::vector<KeyEvent>* params, size_t param_count,
+                             std::vector<KeyEvent>& out);
+
+    /**
+     * @brief 사용된 매개변수 개수 계산
+     * @param events 이벤트 열
+     * @return 가장 큰 매개변수 번호 + 1 (없으면 0)
+     */
+    static uint8_t countParams(const std::vector<KeyEvent>& events);
+
+    /**
+     * @brief 문자를 이 배열로 입력할 수 있는지 확인
+     * @param code_point 코드 포인트 ('\n', '\t' 포함)
+     * @param layout 호스트 키보드 배열
+     * @return true compile()이 키 이벤트를 만드는 문자
+     */
+    static bool isTypeable(uint32_t code_point, uint8_t layout);
+
+    /**
+     * @brief UTF-8 문자 하나 해석
+     * @param text 입력 텍스트
+     * @param length 바이트 길이
+     * @param[in,out] i 현재 위치 (다음 문자 위치로 이동)
+     * @return 코드 포인트 (잘못된 바이트: 0xFFFFFFFF, 1바이트 이동)
+     */
+    static uint32_t decodeUtf8(const char* text, size_t length, size_t& i);
+
+private:
+    /**
+     * @brief 코드 포인트 하나의 키 조합 조회
+     * @param code_point 코드 포인트
+     * @param layout 호스트 키보드 배열
+     * @param[out] strokes 키 조합 (HANGUL_MAX_SYLLABLE_KEYS개 이상)
+     * @param[out] roles 키별 JamoRole (HANGUL_MAX_SYLLABLE_KEYS개 이상)
+     * @return 키 수 (0: 입력 불가)
+     */
+    static size_t strokesFor(uint32_t code_point, uint8_t layout, KeyStroke* strokes, uint8_t* roles);
+
+    /**
+     * @brief 텍스트에 한영 토글 마커가 있는지 확인
+     */
+    static bool containsMarker(const char* text, size_t length);
+};
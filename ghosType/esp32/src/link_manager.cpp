@@ -0,0 +1,221 @@
+/**
+ * @file link_manager.cpp
+ * @brief BLE 링크 관리 정책 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "link_manager.h"
+
+LinkManager::LinkManager(ILinkStack& link_stack)
+    : stack(link_stack), lock(NULL), mode(LINK_MODE_DOWN), params_pending(false), has_requested(false),
+      last_request_ms(0), last_bulk_ms(0), connected_at(0), interval(0), latency(0), timeout(0),
+      tx_octets(0), rx_octets(0), phy_2m(false), mtu(0), connection_bytes(0), burst_bytes(0),
+      burst_started(0), last_burst_bps(0), best_burst_bps(0), requests(0), rejected(0) {
+}
+
+void LinkManager::initialize() {
+    lock = xSemaphoreCreateMutex();
+}
+
+bool LinkManager::isBulk(const uint8_t* data, size_t length) {
+    if (length > LINK_BULK_MESSAGE_BYTES) {
+        return true;
+    }
+    if (length >= 2 && data[0] == FRAME_MARKER) {
+        switch (data[1]) {
+            case FRAME_CHUNK_BEGIN:
+            case FRAME_CHUNK_CONTINUE:
+            case FRAME_STREAM_BEGIN:
+            case FRAME_STREAM_CONTINUE:
+            case FRAME_SEQUENCED:
+                return true;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+void LinkManager::connected(uint32_t now) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    // 중앙 장치는 보통 광고의 선호 간격(BLE_MIN/MAX_CONN_INTERVAL)으로 연결하므로 빠른 상태에서 시작하고
+    // 대량 전송이 없으면 LINK_RELAX_AFTER_MS 뒤에 완화
+    mode = LINK_MODE_BULK;
+    params_pending = false;
+    has_requested = false;
+    connected_at = now;
+    last_bulk_ms = now;
+    interval = latency = timeout = 0;
+    tx_octets = rx_octets = 0;
+    phy_2m = false;
+    connection_bytes = 0;
+    burst_bytes = 0;
+    burst_started = now;
+
+    // 연결마다 한 번 - 유휴 시에도 손해가 없어 되돌리지 않음
+    requests += 2;
+    if (!stack.requestDataLength(BLE_DATA_LENGTH_MAX)) {
+        rejected++;
+    }
+    if (!stack.requestPhy2M()) {
+        rejected++;
+    }
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::disconnected() {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    if (mode == LINK_MODE_BULK) {
+        endBurst();
+    }
+    mode = LINK_MODE_DOWN;
+    params_pending = false;
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::received(const uint8_t* data, size_t length, uint32_t now) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    connection_bytes += length;
+    if (mode == LINK_MODE_BULK) {
+        burst_bytes += length;
+    }
+    if (isBulk(data, length) && mode != LINK_MODE_DOWN) {
+        last_bulk_ms = now;
+        if (mode == LINK_MODE_IDLE) {
+            mode = LINK_MODE_BULK;
+            burst_started = now;
+            burst_bytes = length;
+            requestParams(now);
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::tick(uint32_t now) {
+    if (mode == LINK_MODE_DOWN || xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    if (mode == LINK_MODE_BULK && now - last_bulk_ms > LINK_RELAX_AFTER_MS) {
+        endBurst();
+        mode = LINK_MODE_IDLE;
+        requestParams(now);
+    } else if (params_pending) {
+        requestParams(now);
+    }
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::requestParams(uint32_t now) {
+    if (has_requested && now - last_request_ms < LINK_REQUEST_GAP_MS) {
+        params_pending = true;
+        return;
+    }
+    params_pending = false;
+    has_requested = true;
+    last_request_ms = now;
+    requests++;
+    bool sent = mode == LINK_MODE_BULK
+        ? stack.requestConnParams(BLE_MIN_CONN_INTERVAL, BLE_MAX_CONN_INTERVAL, 0, BLE_TIMEOUT_MULTIPLIER)
+        : stack.requestConnParams(BLE_IDLE_MIN_CONN_INTERVAL, BLE_IDLE_MAX_CONN_INTERVAL,
+                                  BLE_IDLE_SLAVE_LATENCY, BLE_IDLE_TIMEOUT);
+    if (!sent) {
+        rejected++;
+    }
+}
+
+void LinkManager::endBurst() {
+    // 대량 전송 구간: 구간을 시작한 메시지부터 마지막 대량 전송 메시지까지
+    uint32_t duration = last_bulk_ms - burst_started;
+    if (duration > 0 && burst_bytes > 0) {
+        last_burst_bps = (uint32_t)((uint64_t)burst_bytes * 1000 / duration);
+        if (last_burst_bps > best_burst_bps) {
+            best_burst_bps = last_burst_bps;
+        }
+    }
+    burst_bytes = 0;
+}
+
+void LinkManager::paramsUpdated(bool ok, uint16_t new_interval, uint16_t new_latency, uint16_t new_timeout) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    if (ok) {
+        interval = new_interval;
+        latency = new_latency;
+        timeout = new_timeout;
+    } else {
+        rejected++;
+    }
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::dataLengthUpdated(bool ok, uint16_t tx, uint16_t rx) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    if (ok) {
+        tx_octets = tx;
+        rx_octets = rx;
+    } else {
+        rejected++;
+    }
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::phyUpdated(bool ok, bool tx_2m, bool rx_2m) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    if (ok) {
+        phy_2m = tx_2m && rx_2m;
+    } else {
+        rejected++;
+    }
+    xSemaphoreGive(lock);
+}
+
+void LinkManager::mtuUpdated(uint16_t new_mtu) {
+    mtu = new_mtu;
+}
+
+String LinkManager::statsJson() const {
+    static const char* const MODE_NAMES[] = { "down", "bulk", "idle" };
+    uint32_t connected_ms = mode == LINK_MODE_DOWN ? 0 : millis() - connected_at;
+    String json = "{\"mode\":\"";
+    json += MODE_NAMES[mode];
+    json += "\",\"interval_us\":";
+    json += (uint32_t)interval * 1250;
+    json += ",\"latency\":";
+    json += latency;
+    json += ",\"timeout_ms\":";
+    json += (uint32_t)timeout * 10;
+    json += ",\"tx_octets\":";
+    json += tx_octets;
+    json += ",\"rx_octets\":";
+    json += rx_octets;
+    json += ",\"phy\":\"";
+    json += phy_2m ? "2M" : "1M";
+    json += "\",\"mtu\":";
+    json += mtu;
+    json += ",\"requests\":";
+    json += requests;
+    json += ",\"rejected\":";
+    json += rejected;
+    json += ",\"bytes\":";
+    json += connection_bytes;
+    json += ",\"goodput_bps\":";
+    json += connected_ms ? (uint32_t)((uint64_t)connection_bytes * 1000 / connected_ms) : 0;
+    json += ",\"burst_bps\":";
+    json += last_burst_bps;
+    json += ",\"best_burst_bps\":";
+    json += best_burst_bps;
+    json += "}";
+    return json;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file link_manager.h
+ * @brief 트래픽에 따라 BLE 연결 파라미터, 데이터 길이, PHY를 조절하는 링크 관리
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 연결 간격이 고정(광고의 선호 간격)이고 데이터 길이 확장(DLE)과 2M PHY를 요청하지 않으면
+ * 긴 작업의 전송 시간이 연결 이벤트 수에 묶입니다. 링크 관리는 청크/스트림/순번 프레임이나
+ * 큰 메시지가 들어오면 짧은 연결 간격을 요청하고, 연결마다 한 번 최대 데이터 길이와
+ * 2M PHY를 요청합니다. LINK_RELAX_AFTER_MS 동안 대량 전송이 없으면 간격을 늘리고
+ * 슬레이브 지연을 허용해 완화합니다. (DLE와 PHY는 유휴 시에도 손해가 없어 유지)
+ *
+ * 정책은 ILinkStack 뒤의 스택과 분리되어 있어 기기에서는 ESP GAP API(ble_transport.cpp),
+ * 호스트 빌드에서는 중앙 장치를 흉내 내는 대체 스택(host/sim_link_stack.h)으로 같은 코드가 돕니다.
+ * 스택 이벤트(BLE 콜백 태스크), 수신(수신 경로), 주기 확인(경로 태스크)이 다른 태스크에서 오므로
+ * 상태는 뮤텍스로 보호합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "config.h"
+
+/**
+ * @brief 링크 제어 요청을 받는 스택 (결과는 LinkManager의 *Updated로 비동기 전달)
+ */
+class ILinkStack {
+public:
+    virtual ~ILinkStack() {}
+
+    /**
+     * @brief 연결 파라미터 갱신 요청
+     * @param min_interval 최소 연결 간격 (1.25ms 단위)
+     * @param max_interval 최대 연결 간격 (1.25ms 단위)
+     * @param latency 슬레이브 지연 (건너뛸 수 있는 연결 이벤트 수)
+     * @param timeout 감독 시간 (10ms 단위)
+     * @return false 요청을 보내지 못함
+     */
+    virtual bool requestConnParams(uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout) = 0;
+
+    /**
+     * @brief LE 데이터 길이 확장 요청
+     * @param tx_octets 링크 계층 패킷 하나의 최대 데이터 바이트
+     */
+    virtual bool requestDataLength(uint16_t tx_octets) = 0;
+
+    /**
+     * @brief 2M PHY 요청 (송수신 모두)
+     */
+    virtual bool requestPhy2M() = 0;
+};
+
+/**
+ * @brief 링크 관리 클래스
+ */
+class LinkManager {
+public:
+    explicit LinkManager(ILinkStack& stack);
+
+    /**
+     * @brief 뮤텍스 생성 (경로 begin()에서 한 번)
+     */
+    void initialize();
+
+    /**
+     * @brief 연결 - 광고의 선호 간격(빠름)으로 시작한다고 보고 DLE/2M PHY 요청
+     */
+    void connected(uint32_t now);
+
+    void disconnected();
+
+    /**
+     * @brief 수신 메시지 하나 기록 (대량 전송이면 빠른 간격 요청)
+     */
+    void received(const uint8_t* data, size_t length, uint32_t now);
+
+    /**
+     * @brief 주기 확인 (LINK_TICK_MS마다) - 유휴 완화, 미뤄 둔 파라미터 요청
+     */
+    void tick(uint32_t now);
+
+    // 스택 이벤트
+    void paramsUpdated(bool ok, uint16_t interval, uint16_t latency, uint16_t timeout);
+    void dataLengthUpdated(bool ok, uint16_t tx_octets, uint16_t rx_octets);
+    void phyUpdated(bool ok, bool tx_2m, bool rx_2m);
+    void mtuUpdated(uint16_t mtu);
+
+    /**
+     * @brief 대량 전송으로 볼 메시지인지 (청크/스트림/순번 프레임 또는 LINK_BULK_MESSAGE_BYTES 초과)
+     */
+    static bool isBulk(const uint8_t* data, size_t length);
+
+    bool bulk() const { return mode == LINK_MODE_BULK; }
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"mode":"bulk","interval_us":n,"latency":n,"timeout_ms":n,"tx_octets":n,"rx_octets":n,"phy":"2M",
+     *          "mtu":n,"requests":n,"rejected":n,"bytes":n,"goodput_bps":n,"burst_bps":n,"best_burst_bps":n}
+     */
+    String statsJson() const;
+
+private:
+    enum LinkMode : uint8_t {
+        LINK_MODE_DOWN = 0,   ///< 연결 없음
+        LINK_MODE_BULK,       ///< 짧은 간격 (대량 전송 중)
+        LINK_MODE_IDLE        ///< 완화한 간격
+    };
+
+    /**
+     * @brief 현재 모드의 파라미터 요청 (LINK_REQUEST_GAP_MS 안이면 tick까지 미룸, lock을 잡은 상태에서 호출)
+     */
+    void requestParams(uint32_t now);
+
+    /**
+     * @brief 대량 전송 구간 종료 - 구간 처리량 기록
+     */
+    void endBurst();
+
+    ILinkStack& stack;
+    SemaphoreHandle_t lock;
+    volatile uint8_t mode;
+
+    bool params_pending;          ///< 요청하지 못하고 미뤄 둔 파라미터가 있음
+    bool has_requested;           ///< 이번 연결에서 파라미터를 요청한 적 있음
+    uint32_t last_request_ms;
+    uint32_t last_bulk_ms;        ///< 마지막 대량 전송 메시지 시각
+    uint32_t connected_at;
+
+    // 스택이 알려 준 현재 값
+    uint16_t interval;            ///< 1.25ms 단위 (0: 모름)
+    uint16_t latency;
+    uint16_t timeout;             ///< 10ms 단위
+    uint16_t tx_octets;
+    uint16_t rx_octets;
+    bool phy_2m;
+    uint16_t mtu;
+
+    // 처리량
+    uint32_t connection_bytes;    ///< 이번 연결의 수신 바이트
+    uint32_t burst_bytes;         ///< 현재 대량 전송 구간의 수신 바이트
+    uint32_t burst_started;
+    uint32_t last_burst_bps;
+    uint32_t best_burst_bps;
+
+    uint32_t requests;            ///< 보낸 파라미터/DLE/PHY 요청 수
+    uint32_t rejected;            ///< 스택/중앙 장치가 거부한 수
+};
@@ -9,383 +9,1253 @@
 #include <Arduino.h>
 #include <USB.h>
 #include <USBHIDKeyboard.h>
-#include <BLEDevice.h>
-#include <BLEServer.h>
-#include <BLEUtils.h>
-#include <BLE2902.h>
-#include <esp_gap_ble_api.h>
-#include <queue>
 #include <ArduinoJson.h>
+#include "config.h"
+#include "message_lane.h"
+#include "client_scheduler.h"
+#include "job_progress.h"
+#include "keystroke_compiler.h"
+#include "snippet_store.h"
+#include "job_cache.h"
+#include "chunk_assembler.h"
+#include "ime_pacing.h"
+#include "key_pacer.h"
+#include "boot_profile.h"
+#include "session_manager.h"
+#include "host_sync.h"
+#include "mirror_session.h"
+#include "job_pipeline.h"
+#include "stream_ingest.h"
+#include "transport.h"
+#include "link_manager.h"
+#ifdef GHOSTYPE_HOST
+#include "host/socket_transport.h"
+#include "host/replay_transport.h"
+#else
+#include "ble_transport.h"
+#include "cdc_transport.h"
+#endif
 
 // HID 키보드 객체
 USBHIDKeyboard keyboard;
 
-// BLE 객체들
-BLEServer* pServer = NULL;
-BLECharacteristic* pRxCharacteristic = NULL;
-BLECharacteristic* pTxCharacteristic = NULL;
-bool deviceConnected = false;
+// 수신 경로 - 모두 같은 수신 처리를 사용하고, 경로 하나가 클라이언트 하나 (응답은 보낸 경로로만)
+#ifdef GHOSTYPE_HOST
+SocketTransport socketTransport("sock"); // 호스트 빌드: 유닉스 도메인 소켓 (두 객체로 클라이언트 둘까지 동시에)
+SocketTransport socketTransport2("sock2");
+ReplayTransport replayTransport;         // 호스트 빌드: 스크립트 재생 (--replay, 스크립트의 2>는 두 번째 클라이언트)
+ReplayTransport replayTransport2("replay2", &replayTransport);
+ITransport* transports[] = { &socketTransport, &socketTransport2, &replayTransport, &replayTransport2 };
+#else
+BleTransport bleTransport;               // BLE GATT - 중앙 장치(연결)마다 링크 하나
+CdcTransport cdcTransport;               // USB CDC - 같은 호스트의 자동화 도구용 유선 전송
+ITransport* transports[] = { &bleTransport.link(0), &bleTransport.link(1), &cdcTransport };
+static_assert(BLE_MAX_CENTRALS == 2, "BLE 링크 수에 맞게 transports 배열 수정");
+#endif
+constexpr size_t TRANSPORT_COUNT = sizeof(transports) / sizeof(transports[0]);
+
+// 수신 처리 뮤텍스 - 여러 경로의 수신 태스크가 같은 수신 처리를 공유
+SemaphoreHandle_t ingestMutex;
 
-// 타이핑 큐 - BLE로 받은 텍스트를 저장
-std::queue<String> typingQueue;
+// 수신 레인 - 제어 메시지는 키 입력 사이마다 먼저 처리, 텍스트 작업은 클라이언트별 레인에서 작업 경계마다 공정하게 처리
+MessageLane controlLane("ctl", CONTROL_LANE_CAPACITY);
+ClientScheduler bulkScheduler;
 SemaphoreHandle_t queueMutex;
+uint32_t bulkJobsCompleted[TRANSPORT_COUNT] = {};  // 클라이언트별 완료된 벌크 작업 수 (한영 전환 순서 보장용)
 
-// BLE UUID
-#define SERVICE_UUID        "6e400001-b5a3-f393-e0a9-e50e24dcca9e"
-#define RX_CHAR_UUID        "6e400002-b5a3-f393-e0a9-e50e24dcca9e"
-#define TX_CHAR_UUID        "6e400003-b5a3-f393-e0a9-e50e24dcca9e"
+// 클라이언트(수신 경로)별 설정과 상태 - 번호는 transports 배열의 위치
+// 호스트 HID에 묶인 설정(ime_led, ime_gap)과 적응형 학습 간격은 장치 전체에 하나,
+// 학습 간격은 adaptive를 켠 클라이언트의 작업에만 적용 (라이브 미러는 연 클라이언트만 사용)
+struct ClientState {
+    int typing_speed;         ///< 이 클라이언트 작업의 타이핑 속도 (CFG 또는 작업 JSON의 speed_cps)
+    uint8_t layout;           ///< 이 클라이언트 작업을 컴파일할 호스트 키보드 배열 (CFG layout, 작업 JSON의 layout은 그 작업에만)
+    uint32_t progress_ms;     ///< 진행 알림 주기 (0: 끔)
+    bool adaptive;            ///< 이 클라이언트 작업에 적응형 간격과 동기화 장벽 적용 (CFG adaptive)
+    ChunkAssembler chunks;    ///< 청크 재조립 - 수신 처리(ingestMutex)에서만 사용
+    SessionManager session;   ///< 세션 토큰과 끊긴 동안의 응답 보관
+
+    ClientState() : typing_speed(15), layout(LAYOUT_US), progress_ms(0), adaptive(false) {}  // 웹 기본 속도와 동일
+};
+ClientState clients[TRANSPORT_COUNT];
 
 // 타이핑 상태
 bool isTyping = false;
 unsigned long lastTypeTime = 0;
-int globalTypingSpeed = 15; // 웹 기본값과 동일 (selected option)
+int globalTypingSpeed = 15;     // 지금 타이핑하는 작업의 속도 (작업 시작 시 그 클라이언트의 속도)
+uint8_t activeClient = 0;       // 지금(또는 마지막으로) 타이핑한 작업의 클라이언트
+uint8_t streamClient = 0;       // 진행 중인 스트림을 보낸 클라이언트 (스트림은 한 번에 하나)
+uint8_t activeLayout = LAYOUT_US;  // 지금(또는 마지막으로) 타이핑한 작업을 컴파일한 배열
 
-// 청크 변수들 제거됨
+// 진행 알림 - 클라이언트가 progress_ms로 주기를 지정 (기본: 끔)
+JobProgress jobProgress;
 
-// 디버깅 플래그 (디버깅 시에만 true로 설정)  
-#define DEBUG_ENABLED false
+// 최근 작업 캐시 - 재전송 대신 해시 조회로 다시 타이핑 (queueMutex로 보호)
+JobCache jobCache;
 
-// 조건부 시리얼 출력 매크로
-#if DEBUG_ENABLED
-    #define DEBUG_PRINT(x) Serial.print(x)
-    #define DEBUG_PRINTLN(x) Serial.println(x)
-#else
-    #define DEBUG_PRINT(x)
-    #define DEBUG_PRINTLN(x)
-#endif
+// 한글 조합 전환별 최소 간격 - 타이핑 루프와 제어 레인(같은 태스크)에서만 사용
+ImePacing imePacing;
+KeyPacer keyPacer;
 
-// BLE 서버 콜백
-class MyServerCallbacks: public BLEServerCallbacks {
-    void onConnect(BLEServer* pServer) {
-        deviceConnected = true;
-        DEBUG_PRINTLN("BLE 연결됨!");
+// LED 출력 리포트 기반 호스트 동기화 - CFG adaptive로 적응형 속도 조절
+HostSync hostSync;
+
+// 라이브 미러 - 수신 처리에서 컴파일한 키를 큐로 바로 HID 루프에 전달
+MirrorSession mirrorSession;
+uint8_t mirrorClient = 0;       // 미러를 연 클라이언트 (열려 있는 동안 다른 클라이언트의 미러 프레임은 거절)
+
+// 작업 파이프라인 - 컴파일 태스크(코어 0)가 미리 컴파일한 작업을 loop()(코어 1)가 타이핑
+JobPipeline jobPipeline;
+
+// 스트리밍 수신 - 수신 처리가 받는 즉시 컴파일한 키를 타이핑 루프가 링 버퍼에서 꺼내 입력
+StreamIngest streamIngest;
+
+// 클라이언트의 타이핑을 기다리는 작업 수 - 레인 + 컴파일 중/후 (타이핑 중인 작업 제외, queueMutex를 잡은 상태에서 호출)
+size_t queuedJobs(uint8_t client) {
+    uint32_t inFlight = bulkScheduler.served(client) - bulkJobsCompleted[client];
+    if (isTyping && activeClient == client && inFlight > 0) {
+        inFlight--;
+    }
+    return bulkScheduler.size(client) + inFlight;
+}
+
+// 수신 경로의 클라이언트 번호
+uint8_t clientOf(const ITransport& transport) {
+    for (size_t i = 0; i < TRANSPORT_COUNT; i++) {
+        if (transports[i] == &transport) {
+            return (uint8_t)i;
+        }
     }
+    return 0;
+}
+
+// 응답 전송 - 요청한 클라이언트의 수신 경로로만 (BLE TX 특성 알림, USB CDC 프레임 등)
+void sendNotify(uint8_t client, const String& message) {
+    // 잠깐 끊겨 있으면 세션을 재개할 때 다시 보내도록 보관
+    clients[client].session.hold(message);
+    transports[client]->notify(message);
+}
+
+// 제어 레인으로 보낼 메시지인지 판별
+bool isControlMessage(const String& text) {
+    return text.startsWith(PROTOCOL_CONFIG) ||
+           text.startsWith(PROTOCOL_HANENG) ||
+           text.startsWith(PROTOCOL_STATUS);
+}
+
+// 캐시 조회 프레임 해석 - [0xFF][0x02][해시 u32 LE][텍스트 길이 u32 LE]
+bool parseCacheProbe(const String& frame, uint32_t& hash, uint32_t& length) {
+    const uint8_t* data = (const uint8_t*)frame.c_str();
+    if (frame.length() != FRAME_CACHE_PROBE_LENGTH ||
+        data[0] != FRAME_MARKER || data[1] != FRAME_CACHE_PROBE) {
+        return false;
+    }
+    hash = data[2] | (data[3] << 8) | (data[4] << 16) | ((uint32_t)data[5] << 24);
+    length = data[6] | (data[7] << 8) | (data[8] << 16) | ((uint32_t)data[9] << 24);
+    return true;
+}
+
+// 청크 프레임 처리 - 검증이 끝난 청크만 보낸 클라이언트의 벌크 레인에 추가
+void handleChunkFrame(uint8_t client, const uint8_t* frame, size_t length) {
+    ChunkAssembler& chunkAssembler = clients[client].chunks;
+    ChunkResult result = frame[1] == FRAME_CHUNK_BEGIN ?
+        chunkAssembler.begin(frame, length) : chunkAssembler.append(frame, length);
+    uint32_t chunkId = chunkAssembler.chunkId();
     
-    void onDisconnect(BLEServer* pServer) {
-        deviceConnected = false;
-        DEBUG_PRINTLN("BLE 연결 해제됨");
-        delay(500);
-        pServer->getAdvertising()->start();
+    switch (result) {
+        case CHUNK_COMPLETE: {
+            // [0xFF][0x05][번호 u32 LE][데이터] 형태의 내부 작업으로 변환
+            String payload;
+            chunkAssembler.takePayload(payload);
+            const char header[6] = {
+                (char)FRAME_MARKER, (char)FRAME_CHUNK_JOB,
+                (char)(chunkId & 0xFF), (char)((chunkId >> 8) & 0xFF),
+                (char)((chunkId >> 16) & 0xFF), (char)((chunkId >> 24) & 0xFF)
+            };
+            String job;
+            job.reserve(sizeof(header) + payload.length());
+            job.concat(header, sizeof(header));
+            job += payload;
+            
+            bool queued = false;
+            if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+                queued = bulkScheduler.push(client, job, millis());
+                xSemaphoreGive(queueMutex);
+            }
+            if (queued) {
+                chunkAssembler.accept();  // ACK는 타이핑 완료 후 전송
+                jobPipeline.wake();
+            } else {
+                sendNotify(client, "ERR:QUEUE_FULL");
+            }
+            break;
+        }
+        case CHUNK_DUPLICATE:
+            sendNotify(client, "ACK:" + String((unsigned long)chunkId));  // 이미 처리됨
+            break;
+        case CHUNK_CORRUPT:
+            sendNotify(client, "NACK:" + String((unsigned long)chunkId));
+            break;
+        case CHUNK_INVALID:
+            sendNotify(client, "ERR:INVALID_DATA");
+            break;
+        default:
+            break;  // 다음 연속 프레임 대기
     }
-};
+}
+
+// 스트림 프레임 처리 - 시작 프레임에서 벌크 레인에 자리를 잡고, 데이터는 받는 즉시 컴파일
+// 링 버퍼는 하나이므로 스트림은 장치 전체에서 한 번에 하나 (다른 클라이언트의 연속/끝 프레임은 거부)
+void handleStreamFrame(uint8_t client, const uint8_t* frame, size_t length) {
+    if (frame[1] == FRAME_STREAM_BEGIN) {
+        if (!streamIngest.begin(clients[client].layout)) {
+            sendNotify(client, "ERR:BUSY");  // 스트림은 한 번에 하나
+            return;
+        }
+        streamClient = client;
+        // 앞서 받은 작업이 끝난 뒤에 타이핑되도록 자리 표시 작업 추가
+        const char placeholder[2] = { (char)FRAME_MARKER, (char)FRAME_STREAM_JOB };
+        String job;
+        job.concat(placeholder, sizeof(placeholder));
+        bool queued = false;
+        if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+            queued = bulkScheduler.push(client, job, millis());
+            xSemaphoreGive(queueMutex);
+        }
+        if (!queued) {
+            streamIngest.end();
+            sendNotify(client, "ERR:QUEUE_FULL");
+            return;
+        }
+        jobPipeline.wake();
+        sendNotify(client, "OK:Queued for typing");
+    } else if (client != streamClient) {
+        sendNotify(client, "ERR:NO_STREAM");
+        return;
+    }
+    
+    bool wasPaused = streamIngest.paused();
+    bool ok = frame[1] == FRAME_STREAM_END ?
+        streamIngest.finish() : streamIngest.feed(frame + 2, length - 2);
+    if (!ok) {
+        sendNotify(client, streamIngest.overflowed() ? "ERR:STREAM_OVERFLOW" : "ERR:NO_STREAM");
+    } else if (!wasPaused && streamIngest.paused() && frame[1] != FRAME_STREAM_END) {
+        // 타이핑이 따라가지 못함 - 링 버퍼가 절반까지 비면 타이핑 루프가 STREAM:resume
+        sendNotify(client, "STREAM:pause");
+    }
+}
 
-// BLE 데이터 수신 콜백
-class MyCallbacks: public BLECharacteristicCallbacks {
-    void onWrite(BLECharacteristic *pCharacteristic) {
-        std::string rxValue = pCharacteristic->getValue();
+// 수신 메시지 처리 - 모든 수신 경로가 같은 처리를 사용 (ingestMutex로 한 번에 하나씩)
+// 작업은 보낸 클라이언트의 벌크 레인에, 응답은 보낸 클라이언트에게만
+void ingestMessage(uint8_t client, const uint8_t* raw, size_t length) {
+    DEBUG_PRINT("수신 (길이: ");
+    DEBUG_PRINT(length);
+    DEBUG_PRINT("): ");
+    
+    // 메모리 상태 체크
+    DEBUG_PRINT("남은 힙 메모리: ");
+    DEBUG_PRINT(ESP.getFreeHeap());
+    DEBUG_PRINTLN(" bytes");
+    
+    // 너무 긴 텍스트는 거부
+    if (length > MAX_MESSAGE_BYTES) {
+        DEBUG_PRINTLN("텍스트가 너무 깁니다! 10KB 이하로 제한됩니다.");
+        return;
+    }
+    
+    // 청크 프레임은 수신 즉시 조립하고 CRC 누적
+    if (raw[0] == FRAME_MARKER && length >= 2) {
+        if (raw[1] == FRAME_CHUNK_BEGIN || raw[1] == FRAME_CHUNK_CONTINUE) {
+            handleChunkFrame(client, raw, length);
+            return;
+        }
+        if (raw[1] == FRAME_STREAM_BEGIN || raw[1] == FRAME_STREAM_CONTINUE ||
+            raw[1] == FRAME_STREAM_END) {
+            handleStreamFrame(client, raw, length);
+            return;
+        }
+        if (raw[1] == FRAME_CHUNK_JOB || raw[1] == FRAME_STREAM_JOB) {
+            sendNotify(client, "ERR:INVALID_DATA");  // 내부용 프레임
+            return;
+        }
+        // 미러 프레임은 레인/JSON을 거치지 않고 바로 HID 루프로 전달
+        // 미러는 하나 - 연 클라이언트가 연결되어 있는 동안 다른 클라이언트는 쓰지 못함
+        if ((raw[1] == FRAME_MIRROR_KEYS || raw[1] == FRAME_MIRROR_EDIT || raw[1] == FRAME_MIRROR_CONTROL) &&
+            mirrorSession.isOpen() && mirrorClient != client && transports[mirrorClient]->connected()) {
+            sendNotify(client, "ERR:MIRROR_BUSY");
+            return;
+        }
+        if (raw[1] == FRAME_MIRROR_KEYS) {
+            if (!mirrorSession.push((const char*)raw + 2, length - 2)) {
+                sendNotify(client, mirrorSession.lastError());
+            }
+            return;
+        }
+        if (raw[1] == FRAME_MIRROR_EDIT && length >= FRAME_MIRROR_EDIT_HEADER) {
+            // 이미 입력한 텍스트의 일부만 고침 - 커서 이동/지우기/삽입 키로 변환
+            uint32_t start = raw[2] | (raw[3] << 8) | (raw[4] << 16) | ((uint32_t)raw[5] << 24);
+            uint32_t end = raw[6] | (raw[7] << 8) | (raw[8] << 16) | ((uint32_t)raw[9] << 24);
+            if (!mirrorSession.edit(start, end, (const char*)raw + FRAME_MIRROR_EDIT_HEADER,
+                                    length - FRAME_MIRROR_EDIT_HEADER)) {
+                sendNotify(client, mirrorSession.lastError());
+            }
+            return;
+        }
+        if (raw[1] == FRAME_MIRROR_CONTROL && length == 3) {
+            if (raw[2]) {
+                mirrorSession.open(clients[client].layout);
+                mirrorClient = client;
+            } else {
+                mirrorSession.close();
+            }
+            sendNotify(client, raw[2] ? "MIRROR:on" : "MIRROR:off");
+            return;
+        }
+    }
+    
+    // 바이너리 프레임도 담을 수 있도록 길이 기준으로 복사
+    String receivedText;
+    receivedText.concat((const char*)raw, length);
+    DEBUG_PRINTLN(receivedText);
+    
+    // 캐시 조회는 즉시 응답 - 적중하면 조회 프레임 자체를 작업으로 추가
+    uint32_t probeHash = 0;
+    uint32_t probeLength = 0;
+    bool probe = parseCacheProbe(receivedText, probeHash, probeLength);
+    bool hit = false;
+    
+    // 제어 메시지와 텍스트 작업을 각자의 레인에 추가
+    bool control = isControlMessage(receivedText);
+    bool queued = false;
+    if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+        if (probe) {
+            hit = jobCache.probe(probeHash, probeLength, clients[client].layout);
+            queued = !hit || bulkScheduler.push(client, receivedText, millis());
+        } else if (control) {
+            // 한영 전환은 같은 클라이언트가 앞서 보낸 텍스트가 모두 타이핑된 뒤에 실행
+            uint32_t barrier = receivedText.startsWith(PROTOCOL_HANENG) ? bulkScheduler.enqueued(client) : 0;
+            queued = controlLane.push(receivedText, millis(), barrier, client);
+        } else {
+            queued = bulkScheduler.push(client, receivedText, millis());
+        }
+        xSemaphoreGive(queueMutex);
+    }
+    
+    // 벌크 레인에 들어간 작업은 컴파일 태스크가 바로 컴파일
+    if (queued && !control) {
+        jobPipeline.wake();
+    }
+    
+    // 응답 전송 (제어 메시지는 처리 시점에 응답)
+    if (!queued) {
+        DEBUG_PRINTLN(control ? "제어 레인 가득 참" : "벌크 레인 가득 참");
+        sendNotify(client, "ERR:QUEUE_FULL");
+    } else if (probe) {
+        char reply[24];
+        snprintf(reply, sizeof(reply), "%s:%08lx", hit ? "HIT" : "MISS", (unsigned long)probeHash);
+        sendNotify(client, reply);
+    } else if (!control) {
+        DEBUG_PRINTLN("일반 텍스트 큐에 추가됨");
+        sendNotify(client, "OK:Queued for typing");
+    }
+}
+
+// 세션 시작/재개 - GHTYPE_SES:{"token":"1a2b3c4d"} (ingestMutex를 잡은 채 요청한 경로로만 바로 응답)
+// 재개 응답에는 클라이언트가 이어 보낼 위치(스트림/청크 받은 바이트)와 작업 진행을 담고,
+// 끊긴 동안 보관한 응답을 그 뒤에 차례로 다시 보냄 (세션은 클라이언트마다 따로)
+void handleSessionRequest(ITransport& from, const uint8_t* data, size_t length) {
+    uint8_t client = clientOf(from);
+    ClientState& state = clients[client];
+    SessionManager& sessionManager = state.session;
+    size_t prefix = strlen(PROTOCOL_SESSION);
+    StaticJsonDocument<128> sessionDoc;
+    uint32_t token = 0;
+    if (!deserializeJson(sessionDoc, (const char*)data + prefix, length - prefix)) {
+        token = strtoul(sessionDoc["token"] | "0", NULL, 16);
+    }
+    std::vector<String> held;
+    bool resumed = sessionManager.open(from, token, held);
+    
+    char tokenText[12];
+    snprintf(tokenText, sizeof(tokenText), "%08lx", (unsigned long)sessionManager.token());
+    String reply = "SES:{\"token\":\"";
+    reply += tokenText;
+    reply += "\",\"resumed\":";
+    reply += resumed ? "true" : "false";
+    reply += ",\"offline_ms\":";
+    reply += resumed ? sessionManager.offlineMs() : 0;
+    reply += ",\"resume_ms\":";
+    reply += resumed ? sessionManager.resumeMs() : 0;
+    reply += ",\"held\":";
+    reply += (unsigned int)held.size();
+    reply += ",\"cps\":";
+    reply += state.typing_speed;
+    reply += ",\"layout\":\"";
+    reply += Keymap::name(state.layout);
+    reply += "\",\"mirror\":";
+    reply += mirrorSession.isOpen() && mirrorClient == client ? "true" : "false";
+    // 작업 진행은 이 클라이언트의 작업을 타이핑 중일 때만
+    size_t queued = 0;
+    if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+        queued = queuedJobs(client);
+        xSemaphoreGive(queueMutex);
+    }
+    bool ownJob = isTyping && activeClient == client;
+    bool ownStream = streamIngest.active() && streamClient == client;
+    reply += ",\"job\":{\"typing\":";
+    reply += ownJob ? "true" : "false";
+    reply += ",\"typed_chars\":";
+    reply += ownJob ? (unsigned int)jobProgress.typedChars() : 0;
+    reply += ",\"total_chars\":";
+    reply += ownJob ? (unsigned int)jobProgress.totalChars() : 0;
+    reply += ",\"queued\":";
+    reply += (unsigned int)queued;
+    reply += "},\"stream\":{\"active\":";
+    reply += ownStream ? "true" : "false";
+    reply += ",\"bytes\":";
+    reply += ownStream ? streamIngest.receivedBytes() : 0;
+    reply += "},\"chunk\":{\"active\":";
+    reply += state.chunks.assembling() ? "true" : "false";
+    reply += ",\"id\":";
+    reply += state.chunks.chunkId();
+    reply += ",\"received\":";
+    reply += state.chunks.receivedBytes();
+    reply += "}}";
+    from.notify(reply);
+    for (const String& message : held) {
+        from.notify(message);
+    }
+}
+
+// 수신 경로 공통 진입점 - 청크/스트림 조립기와 미러 세션은 한 번에 한 태스크만 사용
+void onTransportReceive(ITransport& from, const uint8_t* data, size_t length) {
+    if (FrameSequencer::isSequenced(data, length)) {
+        // 순번 프레임 - 차례가 된 메시지마다 이 함수로 다시 들어옴 (잠금은 그때 잡음)
+        // SACK는 링크 수준 응답이라 세션 보관 없이 받은 경로로만 보냄
+        if (from.sequencer().receive(from, data, length, onTransportReceive)) {
+            from.notify(from.sequencer().ackMessage());
+        }
+        return;
+    }
+    if (xSemaphoreTake(ingestMutex, portMAX_DELAY) == pdTRUE) {
+        size_t prefix = strlen(PROTOCOL_SESSION);
+        if (length >= prefix && memcmp(data, PROTOCOL_SESSION, prefix) == 0) {
+            handleSessionRequest(from, data, length);
+        } else {
+            ingestMessage(clientOf(from), data, length);
+        }
+        xSemaphoreGive(ingestMutex);
+    }
+}
+
+// 수신 경로 연결/해제
+void onTransportConnection(ITransport& from, bool connected) {
+    clients[clientOf(from)].session.connectionChanged(from, connected);
+    if (connected) {
+        BootProfile::mark(BOOT_PHASE_CONNECTED);
+    }
+    DEBUG_PRINT(from.name());
+    DEBUG_PRINTLN(connected ? " 연결됨!" : " 연결 해제됨");
+}
+
+// USB 장치 이벤트 (USB 이벤트 태스크) - 호스트 열거 시각 기록
+void onUsbEvent(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    if (id == ARDUINO_USB_STARTED_EVENT) {
+        BootProfile::mark(BOOT_PHASE_USB_MOUNTED);
+    }
+}
+
+// 키를 보내도 되는지 - 호스트가 열거하기 전 리포트는 버려지므로 부팅 직후에는 열거를 기다림
+// (충전기처럼 열거하지 않는 호스트에서도 BOOT_HID_WAIT_MS 뒤에는 그대로 진행)
+bool hidReady() {
+    return BootProfile::reached(BOOT_PHASE_USB_MOUNTED) || millis() > BOOT_HID_WAIT_MS;
+}
+
+// 한영 전환 - Alt+Shift 조합
+void sendHanEngToggle() {
+    keyboard.press(KEY_LEFT_ALT);
+    delay(HANENG_PRESS_DELAY_MS);
+    keyboard.press(KEY_LEFT_SHIFT);
+    delay(HANENG_PRESS_DELAY_MS);
+    keyboard.release(KEY_LEFT_SHIFT);
+    keyboard.release(KEY_LEFT_ALT);
+    hostSync.noteToggle();
+    delay(HANENG_SETTLE_MS);
+}
+
+// 호스트 LED 출력 리포트 수신 (USB 이벤트 태스크)
+void onKeyboardLed(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    arduino_usb_hid_keyboard_event_data_t* event = (arduino_usb_hid_keyboard_event_data_t*)data;
+    hostSync.onLedReport(event->leds);
+}
+
+// 동기화 장벽 - 잠금 키를 눌러 LED 응답까지의 왕복 시간 측정 (두 번 눌러 원래 상태로 복원)
+void runSyncBarrier() {
+    for (int pass = 0; pass < 2; pass++) {
+        bool target = (hostSync.leds() & SYNC_LOCK_LED) == 0;
+        uint32_t started = millis();
+        keyboard.press(SYNC_LOCK_KEY);
+        keyboard.release(SYNC_LOCK_KEY);
+        bool echoed = hostSync.waitForLed(SYNC_LOCK_LED, target, SYNC_BARRIER_TIMEOUT_MS);
+        hostSync.recordBarrier(echoed, millis() - started);
+    }
+}
+
+// 지금 타이핑하는 작업의 클라이언트가 적응형 모드인지 (다른 클라이언트 작업은 자기 speed_cps 그대로)
+bool adaptiveNow() {
+    return clients[activeClient].adaptive;
+}
+
+// 현재 기본 키 간격 - 마이크로초 (적응형 모드이면 학습한 간격)
+uint32_t typingGapUs() {
+    uint32_t requested = 1000000UL / globalTypingSpeed;
+    return adaptiveNow() ? hostSync.keyDelayUs(requested) : requested;
+}
+
+// 상태 보고에 쓰는 현재 속도
+int typingSpeedNow() {
+    return 1000000UL / MAX(typingGapUs(), 1);
+}
+
+// 진행 중인 작업의 예상 남은 시간 - 타이핑 루프가 둘 조합 전환 간격과 동기화 장벽 대기 포함
+uint32_t jobEtaMs() {
+    return jobProgress.etaMs(typingGapUs(), imePacing, adaptiveNow() ? hostSync.barrierCostMs() : 0);
+}
+
+// 상태/통계 보고 생성 - 속도/배열/청크/세션은 요청한 클라이언트 기준 (queueMutex를 잡은 상태에서 호출)
+String buildStatusReport(uint8_t client) {
+    const ClientState& state = clients[client];
+    String report = "STS:{\"typing\":";
+    report += isTyping ? "true" : "false";
+    report += ",\"cps\":";
+    report += state.typing_speed;
+    report += ",\"effective_cps\":";
+    report += typingSpeedNow();
+    report += ",\"layout\":\"";
+    report += Keymap::name(state.layout);
+    report += "\",\"client\":\"";
+    report += transports[client]->name();
+    report += "\",\"active_client\":\"";
+    report += transports[activeClient]->name();
+    report += "\"";
+    report += ",\"job\":{\"typed_chars\":";
+    report += (unsigned int)jobProgress.typedChars();
+    report += ",\"total_chars\":";
+    report += (unsigned int)jobProgress.totalChars();
+    report += ",\"layout\":\"";
+    report += Keymap::name(activeLayout);
+    report += "\"";
+    report += ",\"eta\":";
+    report += jobEtaMs();
+    report += ",\"progress_ms\":";
+    report += state.progress_ms;
+    report += ",\"toggles\":";
+    report += (unsigned int)jobProgress.toggles();
+    report += ",\"toggles_removed\":";
+    report += (unsigned int)jobProgress.togglesRemoved();
+    report += ",\"toggle_saved_ms\":";
+    report += (unsigned int)(jobProgress.togglesRemoved() * typingKeyCostMs(KEY_EVENT_TOGGLE, typingSpeedNow()));
+    report += "}";
+    report += ",\"ctl\":";
+    report += controlLane.statsJson();
+    report += ",\"bulk\":";
+    report += bulkScheduler.statsJson();
+    report += ",\"cache\":";
+    report += jobCache.statsJson();
+    report += ",\"chunk\":";
+    report += state.chunks.statsJson();
+    report += ",\"ime\":";
+    report += imePacing.statsJson();
+    report += ",\"pacing\":";
+    report += keyPacer.statsJson();
+    report += ",\"boot\":";
+    report += BootProfile::statsJson();
+    report += ",\"session\":";
+    report += state.session.statsJson();
+    report += ",\"sync\":";
+    report += hostSync.statsJson();
+    report += ",\"mirror\":";
+    report += mirrorSession.statsJson();
+    report += ",\"pipeline\":";
+    report += jobPipeline.statsJson();
+    report += ",\"stream\":";
+    report += streamIngest.statsJson();
+    report += ",\"transports\":{";
+    for (size_t i = 0; i < sizeof(transports) / sizeof(transports[0]); i++) {
+        report += i ? ",\"" : "\"";
+        report += transports[i]->name();
+        report += "\":";
+        report += transports[i]->counter().statsJson();
+    }
+    report += "}";
+    report += ",\"seq\":{";
+    for (size_t i = 0; i < sizeof(transports) / sizeof(transports[0]); i++) {
+        report += i ? ",\"" : "\"";
+        report += transports[i]->name();
+        report += "\":";
+        report += transports[i]->sequencer().statsJson();
+    }
+    report += "}";
+    report += ",\"link\":{";
+    bool first_link = true;
+    for (size_t i = 0; i < sizeof(transports) / sizeof(transports[0]); i++) {
+        const LinkManager* link = transports[i]->link();
+        if (!link) {
+            continue;
+        }
+        report += first_link ? "\"" : ",\"";
+        report += transports[i]->name();
+        report += "\":";
+        report += link->statsJson();
+        first_link = false;
+    }
+    report += "}";
+    report += "}";
+    return report;
+}
+
+// 조합 전환별 최소 간격 설정 - [["carry","jung",45], ...] 또는 "default"
+void applyImeGaps(uint8_t client, JsonVariantConst gaps) {
+    if (gaps.is<const char*>()) {
+        imePacing.reset();
+        sendNotify(client, "IME_GAP:default");
+        return;
+    }
+    size_t applied = 0;
+    for (size_t i = 0; i < gaps.size(); i++) {
+        uint8_t from, to;
+        if (ImePacing::roleFromName(gaps[i][0] | "", from) &&
+            ImePacing::roleFromName(gaps[i][1] | "", to) &&
+            imePacing.set(from, to, gaps[i][2] | 0)) {
+            applied++;
+        }
+    }
+    sendNotify(client, applied == gaps.size() ? "IME_GAP:" + String(applied) : String("ERR:UNKNOWN_ROLE"));
+}
+
+// 제어 메시지 처리 - 설정 변경, 한영 전환, 상태 조회
+// 속도/진행 간격/배열/가중치는 보낸 클라이언트의 설정, 나머지(적응, LED, 조합 간격)는 HID 출력 하나에 묶여 장치 전역
+void handleControlMessage(const QueuedMessage& message) {
+    const String& text = message.data;
+    uint8_t client = message.client;
+    ClientState& state = clients[client];
+    if (text.startsWith(PROTOCOL_CONFIG)) {
+        // 설정 프로토콜 처리 - 진행 중인 작업의 다음 키부터 적용
+        String configJson = text.substring(strlen(PROTOCOL_CONFIG));
+        StaticJsonDocument<512> configDoc;
+        DeserializationError configError = deserializeJson(configDoc, configJson);
         
-        if (rxValue.length() > 0) {
-            DEBUG_PRINT("BLE 수신 (길이: ");
-            DEBUG_PRINT(rxValue.length());
-            DEBUG_PRINT("): ");
-            
-            // 메모리 상태 체크
-            DEBUG_PRINT("남은 힙 메모리: ");
-            DEBUG_PRINT(ESP.getFreeHeap());
-            DEBUG_PRINTLN(" bytes");
-            
-            // 너무 긴 텍스트는 거부
-            if (rxValue.length() > 10000) {
-                DEBUG_PRINTLN("텍스트가 너무 깁니다! 10KB 이하로 제한됩니다.");
-                return;
+        if (!configError && configDoc.containsKey("speed_cps")) {
+            int speed = configDoc["speed_cps"];
+            state.typing_speed = CLAMP(speed, MIN_TYPING_SPEED_CPS, MAX_TYPING_SPEED_CPS);
+            if (isTyping && activeClient == client) {
+                globalTypingSpeed = state.typing_speed;  // 이 클라이언트의 작업이면 다음 키부터
             }
-            
-            String receivedText = String(rxValue.c_str());
-            DEBUG_PRINTLN(receivedText);
-            
-            // 일반 데이터 처리 - 직접 큐에 추가
+            DEBUG_PRINT("타이핑 속도 설정: ");
+            DEBUG_PRINTLN(state.typing_speed);
+            sendNotify(client, "SPD:" + String(state.typing_speed));
+        }
+        if (!configError && configDoc.containsKey(JSON_FIELD_PROGRESS)) {
+            state.progress_ms = configDoc[JSON_FIELD_PROGRESS].as<unsigned long>();
+            if (isTyping && activeClient == client) {
+                jobProgress.setInterval(state.progress_ms);
+            }
+        }
+        if (!configError && configDoc.containsKey(JSON_FIELD_WEIGHT)) {
+            // 대량 레인 몫 - 다른 클라이언트와 경쟁할 때 가중치에 비례해 작업을 꺼냄
+            // uint8_t로 잘리기 전에 int로 읽어 범위를 확인 (256 → 0 같은 값이 통과하지 않도록)
+            int weight = configDoc[JSON_FIELD_WEIGHT] | 0;
+            bool valid = false;
             if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
-                typingQueue.push(receivedText);
+                valid = bulkScheduler.setWeight(client, weight);
                 xSemaphoreGive(queueMutex);
-                DEBUG_PRINTLN("일반 텍스트 큐에 추가됨");
             }
-            
-            // 응답 전송
-            if (pTxCharacteristic && deviceConnected) {
-                String response = "OK:Queued for typing";
-                pTxCharacteristic->setValue(response.c_str());
-                pTxCharacteristic->notify();
+            sendNotify(client, valid ? "WEIGHT:" + String(bulkScheduler.weight(client)) : String("ERR:WEIGHT_RANGE"));
+        }
+        if (!configError && configDoc.containsKey(JSON_FIELD_LAYOUT)) {
+            // 이후에 컴파일하는 작업부터 적용
+            const char* layoutName = configDoc[JSON_FIELD_LAYOUT] | "";
+            bool known = Keymap::fromName(layoutName, state.layout);
+            sendNotify(client, known ? String("LAYOUT:") + layoutName : String("ERR:UNKNOWN_LAYOUT"));
+        }
+        if (!configError && configDoc.containsKey(JSON_FIELD_ADAPTIVE)) {
+            // 이 클라이언트 작업에만 적용 - 학습은 처음 켠 클라이언트의 speed_cps에서 시작해
+            // 켠 클라이언트가 하나라도 남아 있는 동안 이어감 (학습 간격은 호스트 특성이라 공유)
+            bool adaptive = configDoc[JSON_FIELD_ADAPTIVE] | false;
+            state.adaptive = adaptive;
+            bool anyAdaptive = false;
+            for (size_t i = 0; i < TRANSPORT_COUNT; i++) {
+                anyAdaptive = anyAdaptive || clients[i].adaptive;
             }
+            if (anyAdaptive != hostSync.adaptive()) {
+                hostSync.setAdaptive(anyAdaptive, 1000 / state.typing_speed);
+            }
+            sendNotify(client, adaptive ? "ADAPTIVE:on" : "ADAPTIVE:off");
+        }
+        if (!configError && configDoc.containsKey(JSON_FIELD_IME_LED)) {
+            bool mirrored = configDoc[JSON_FIELD_IME_LED] | false;
+            hostSync.setImeLed(mirrored);
+            sendNotify(client, mirrored ? "IME_LED:on" : "IME_LED:off");
+        }
+        if (!configError && configDoc.containsKey(JSON_FIELD_IME_GAP)) {
+            applyImeGaps(client, configDoc[JSON_FIELD_IME_GAP]);
+        }
+    } else if (text.startsWith(PROTOCOL_HANENG)) {
+        sendHanEngToggle();
+    } else if (text.startsWith(PROTOCOL_STATUS)) {
+        String report;
+        if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+            report = buildStatusReport(client);
+            xSemaphoreGive(queueMutex);
         }
+        sendNotify(client, report);
     }
-};
+}
 
-// 타이핑 작업 처리
-void processTypingQueue() {
-    if (xSemaphoreTake(queueMutex, 0) == pdTRUE) {
-        if (!typingQueue.empty() && !isTyping) {
-            String text = typingQueue.front();
-            typingQueue.pop();
+// 제어 레인 처리 - 유휴 시에는 loop()에서, 타이핑 중에는 키 입력 사이마다 호출
+void serviceControlLane() {
+    QueuedMessage message;
+    while (true) {
+        bool found = false;
+        if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+            found = controlLane.popReady(message, millis(), bulkJobsCompleted);
             xSemaphoreGive(queueMutex);
-            
-            // 타이핑 시작
-            isTyping = true;
-            DEBUG_PRINT("타이핑 시작: ");
-            DEBUG_PRINTLN(text);
-            
-            // JSON 또는 일반 텍스트 파싱
-            String textToType = "";
-            int speed_cps = globalTypingSpeed; // 웹에서 전달받은 속도만 사용
-            
-            // JSON 파싱 시도
-            if (text.startsWith("{")) {
-                DEBUG_PRINTLN("=== JSON 파싱 시작 ===");
-                StaticJsonDocument<8192> doc; // 크기를 8KB로 증가
-                DeserializationError error = deserializeJson(doc, text);
-                
-                DEBUG_PRINT("JSON 파싱 결과: ");
-                if (error) {
-                    DEBUG_PRINT("실패 - ");
-                    DEBUG_PRINTLN(error.c_str());
-                    textToType = text; // JSON 파싱 실패시 원본 텍스트 사용
-                } else {
-                    DEBUG_PRINTLN("성공");
-                    
-                    if (doc.containsKey("text")) {
-                        textToType = doc["text"].as<String>();
-                        DEBUG_PRINT("추출된 텍스트: '");
-                        DEBUG_PRINT(textToType);
-                        DEBUG_PRINTLN("'");
-                        
-                        if (doc.containsKey("speed_cps")) {
-                            speed_cps = doc["speed_cps"];
-                            globalTypingSpeed = speed_cps; // 전역 속도도 업데이트
-                            DEBUG_PRINT("JSON에서 타이핑 속도 업데이트: ");
-                            DEBUG_PRINTLN(speed_cps);
-                        }
-                    } else {
-                        DEBUG_PRINTLN("JSON에 'text' 키가 없음");
-                        textToType = text; // text 키가 없으면 원본 사용
-                    }
-                }
-            } else if (text.startsWith("GHTYPE_CFG:")) {
-                // 설정 프로토콜 처리
-                String configJson = text.substring(11);
-                StaticJsonDocument<256> configDoc;
-                DeserializationError configError = deserializeJson(configDoc, configJson);
-                
-                if (!configError && configDoc.containsKey("speed_cps")) {
-                    globalTypingSpeed = configDoc["speed_cps"];
-                    speed_cps = globalTypingSpeed;
-                    DEBUG_PRINT("타이핑 속도 설정: ");
-                    DEBUG_PRINTLN(globalTypingSpeed);
+        }
+        if (!found) {
+            break;
+        }
+        handleControlMessage(message);
+    }
+}
+
+// 컴파일된 키 이벤트 하나를 HID로 출력
+// 앞 키가 예약한 마감 시각까지 기다린 뒤 보내고, 글자 키이면 다음 키의 마감을 gap_us 뒤로 예약
+void emitKeyEvent(const KeyEvent& event, uint32_t gap_us) {
+    keyPacer.waitForSlot();
+    switch (event.kind) {
+        case KEY_EVENT_ENTER:
+            // 엔터키 - 더 많은 딜레이 추가
+            DEBUG_PRINTLN("엔터키 입력!");
+            delay(ENTER_PRE_DELAY_MS); // 엔터키 전 딜레이 증가
+            keyboard.press(KEY_RETURN);
+            delay(ENTER_HOLD_MS); // 엔터키 누름 딜레이 대폭 증가
+            keyboard.release(KEY_RETURN);
+            delay(ENTER_POST_DELAY_MS); // 엔터키 후 딜레이 대폭 증가
+            keyPacer.interrupt();
+            break;
+        case KEY_EVENT_TAB:
+            // 탭키
+            DEBUG_PRINTLN("탭키 입력!");
+            keyboard.press(KEY_TAB);
+            delay(TAB_HOLD_MS);
+            keyboard.release(KEY_TAB);
+            delay(TAB_POST_DELAY_MS);
+            keyPacer.interrupt();
+            break;
+        case KEY_EVENT_TOGGLE:
+            // 호스트 모드를 LED로 알고 있으면 이미 원하는 모드일 때 건너뜀
+            if (hostSync.needsToggle(event)) {
+                sendHanEngToggle();
+            }
+            keyPacer.interrupt();
+            break;
+        case KEY_EVENT_CHAR: {
+            // 일반 문자 - 배열 표에서 정한 키와 수정키를 한 리포트로 전송 (Caps Lock 반영)
+            KeyReport report = { hostSync.modifiersFor(event), 0, { event.code, 0, 0, 0, 0, 0 } };
+            keyboard.sendReport(&report);
+            memset(&report, 0, sizeof(report));
+            keyboard.sendReport(&report);
+            keyPacer.scheduleNext(gap_us); // 타이핑 속도 조절 - 기다림은 다음 키 직전에
+            break;
+        }
+        default:
+            keyPacer.interrupt();
+            break; // 치환되지 않은 매개변수 자리
+    }
+}
+
+// 미러 키 입력 - 최대 wait_ms 동안 키를 기다리고, 오면 큐가 빌 때까지 간격 없이 입력
+void serviceMirror(uint32_t wait_ms) {
+    MirrorKey key;
+    while (mirrorSession.pop(key, wait_ms)) {
+        emitKeyEvent(key.event, 0);
+        mirrorSession.recordLatency(micros() - key.received_us);
+        wait_ms = 0;
+    }
+}
+
+// 진행률과 예상 완료 시간을 한 번의 알림으로 전송 (타이핑 중인 작업의 클라이언트에게, 남은 작업은 그 클라이언트 것만)
+void sendProgressReport() {
+    char report[64];
+    size_t queued = 0;
+    if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+        queued = queuedJobs(activeClient);
+        xSemaphoreGive(queueMutex);
+    }
+    jobProgress.formatReport(report, sizeof(report), jobEtaMs(), queued);
+    sendNotify(activeClient, report);
+}
+
+// 키 이벤트 열 타이핑 - 키 입력 사이마다 제어 레인과 진행 알림 처리
+void typeKeyEvents(std::vector<KeyEvent>& events) {
+    // 숫자/문장 부호만 사이에 둔 한영 전환 쌍 제거 (캐시/스니펫 재생 포함 모든 작업)
+    size_t togglesRemoved = KeystrokeCompiler::minimizeToggles(events);
+    
+    DEBUG_PRINT("=== 타이핑 시작 === 이벤트 수: ");
+    DEBUG_PRINTLN(events.size());
+    
+    jobProgress.begin(events.data(), events.size(), millis());
+    jobProgress.setTogglesRemoved(togglesRemoved);
+    keyPacer.beginJob();
+    BootProfile::mark(BOOT_PHASE_FIRST_JOB);
+    
+    for (size_t i = 0; i < events.size(); i++) {
+        // 속도에 따른 간격 계산 (제어 레인의 속도 변경은 다음 키부터 적용)
+        // IME가 놓치기 쉬운 조합 전환 앞에서만 최소 간격까지 늘림
+        const KeyEvent* next = i + 1 < events.size() ? &events[i + 1] : NULL;
+        emitKeyEvent(events[i], imePacing.delayAfter(events[i], next, typingGapUs()));
+        jobProgress.advance(events[i], next);
+        
+        // 적응형 모드 - 주기적으로 호스트가 따라오는지 확인하고 간격 조절
+        if (adaptiveNow() && hostSync.keyTyped(events[i])) {
+            runSyncBarrier();
+        }
+        
+        // 키 입력 사이에 제어 레인 처리
+        serviceControlLane();
+        
+        // 주기마다 진행률과 예상 완료 시간을 한 번의 알림으로 전송
+        if (jobProgress.reportDue(millis())) {
+            sendProgressReport();
+        }
+    }
+    
+    jobProgress.finish();
+}
+
+// 스트림 작업 타이핑 - 수신 중인 키 이벤트를 링 버퍼에서 꺼내는 즉시 입력
+// 다음 이벤트가 아직 도착하지 않았으면 조합 간격은 기본 간격으로 계산
+bool typeStreamJob() {
+    jobProgress.begin(NULL, 0, millis());
+    keyPacer.beginJob();
+    BootProfile::mark(BOOT_PHASE_FIRST_JOB);
+    KeyEvent current;
+    bool have = false;
+    bool settingsApplied = false;
+    uint32_t lastData = millis();
+    
+    while (true) {
+        if (streamIngest.refillDue() && xSemaphoreTake(ingestMutex, 0) == pdTRUE) {
+            // 일시 정지 중 - 보관분을 채우고 정지를 풂 (수신 처리 중이면 다음 반복에서 다시 시도)
+            bool resumed = streamIngest.refill();
+            xSemaphoreGive(ingestMutex);
+            if (resumed) {
+                sendNotify(streamClient, "STREAM:resume");
+            }
+        }
+        
+        KeyEvent following;
+        bool more = streamIngest.next(following);
+        if (more) {
+            lastData = millis();
+            jobProgress.extend(following);
+            if (!settingsApplied) {
+                // 작업 JSON의 설정은 "text"보다 앞에 있으므로 첫 이벤트가 오면 모두 읽힌 상태
+                settingsApplied = true;
+                ClientState& state = clients[streamClient];
+                if (streamIngest.speedCps() >= 0) {
+                    state.typing_speed = globalTypingSpeed = streamIngest.speedCps();
                 }
-                textToType = ""; // 설정만 처리하고 타이핑 없음
-            } else if (text.startsWith("GHTYPE_")) {
-                // 레거시 형식 지원
-                if (text.startsWith("GHTYPE_KOR:")) {
-                    textToType = text.substring(11);
-                } else if (text.startsWith("GHTYPE_ENG:")) {
-                    textToType = text.substring(11);
-                } else if (text.startsWith("GHTYPE_SPE:haneng")) {
-                    // 한영 전환 - Alt+Shift 조합
-                    keyboard.press(KEY_LEFT_ALT);
-                    delay(10);
-                    keyboard.press(KEY_LEFT_SHIFT);
-                    delay(10);
-                    keyboard.release(KEY_LEFT_SHIFT);
-                    keyboard.release(KEY_LEFT_ALT);
-                    delay(50);
-                    textToType = ""; // 타이핑할 텍스트 없음
-                } else {
-                    textToType = text;
+                if (streamIngest.progressMs() >= 0) {
+                    state.progress_ms = streamIngest.progressMs();
+                    jobProgress.setInterval(state.progress_ms);
                 }
-            } else {
-                textToType = text; // 일반 텍스트
+                activeLayout = streamIngest.layout();  // 이 스트림에만 적용 (클라이언트 배열은 CFG로만 바뀜)
             }
-            
-            // 실제 타이핑
-            if (textToType.length() > 0) {
-                int delay_ms = 1000 / speed_cps; // 속도에 따른 딜레이 계산
-                
-                DEBUG_PRINT("=== 타이핑 시작 ===");
-                DEBUG_PRINT("타이핑할 텍스트: '");
-                DEBUG_PRINT(textToType);
-                DEBUG_PRINTLN("'");
-                DEBUG_PRINT("텍스트 길이: ");
-                DEBUG_PRINTLN(textToType.length());
-                DEBUG_PRINT("타이핑 속도: ");
-                DEBUG_PRINT(speed_cps);
-                DEBUG_PRINT(" CPS, 딜레이: ");
-                DEBUG_PRINT(delay_ms);
-                DEBUG_PRINTLN("ms");
-                DEBUG_PRINTLN("=== 문자별 처리 시작 ===");
-                
-                for (int i = 0; i < textToType.length(); i++) {
-                    char c = textToType[i];
-                    
-                    DEBUG_PRINT("문자 ");
-                    DEBUG_PRINT(i);
-                    DEBUG_PRINT(": ASCII ");
-                    DEBUG_PRINT((int)c);
-                    DEBUG_PRINT(" (");
-                    if (c == '\n') {
-                        DEBUG_PRINT("엔터키");
-                    } else if (c == '\r') {
-                        DEBUG_PRINT("캐리지 리턴");
-                    } else if (c == '\t') {
-                        DEBUG_PRINT("탭");
-                    } else if (c >= 32 && c <= 126) {
-                        DEBUG_PRINT(c);
-                    } else {
-                        DEBUG_PRINT("특수문자");
-                    }
-                    DEBUG_PRINTLN(")");
-                    
-                    // 특수 문자 처리
-                    if (c == '\n' || c == '\r') {
-                        // 엔터키 - 더 많은 딜레이 추가
-                        DEBUG_PRINTLN("엔터키 입력!");
-                        delay(50); // 엔터키 전 딜레이 증가
-                        keyboard.press(KEY_RETURN);
-                        delay(100); // 엔터키 누름 딜레이 대폭 증가
-                        keyboard.release(KEY_RETURN);
-                        delay(100); // 엔터키 후 딜레이 대폭 증가
-                    } else if (c == '\t') {
-                        // 탭키
-                        DEBUG_PRINTLN("탭키 입력!");
-                        keyboard.press(KEY_TAB);
-                        delay(50);
-                        keyboard.release(KEY_TAB);
-                        delay(50);
-                    } else {
-                        // 일반 문자
-                        keyboard.write(c);
-                        delay(delay_ms); // 타이핑 속도 조절
-                    }
-                }
+        }
+        
+        if (!have) {
+            if (more) {
+                current = following;
+                have = true;
+                continue;
             }
-            
-            DEBUG_PRINTLN("타이핑 완료!");
-            isTyping = false;
-            lastTypeTime = millis();
-            
-            // 완료 응답 전송
-            if (pTxCharacteristic && deviceConnected) {
-                String response = "OK:Typing completed";
-                pTxCharacteristic->setValue(response.c_str());
-                pTxCharacteristic->notify();
+            if (streamIngest.drained()) {
+                break;
             }
-            
-        } else {
-            xSemaphoreGive(queueMutex);
+            if (millis() - lastData > STREAM_STALL_TIMEOUT_MS) {
+                // 클라이언트가 끝 프레임 없이 사라짐 - 받은 만큼만 입력하고 중단
+                streamIngest.recordTimeout();
+                streamIngest.end();
+                jobProgress.finish();
+                sendNotify(streamClient, "ERR:STREAM_TIMEOUT");
+                return false;
+            }
+            // 다음 조각을 기다리는 동안에도 제어 레인 처리
+            serviceControlLane();
+            delay(1);
+            continue;
+        }
+        
+        emitKeyEvent(current, imePacing.delayAfter(current, more ? &following : NULL, typingGapUs()));
+        streamIngest.firstKeyTyped();
+        jobProgress.advance(current, more ? &following : NULL);
+        
+        if (adaptiveNow() && hostSync.keyTyped(current)) {
+            runSyncBarrier();
+        }
+        serviceControlLane();
+        if (jobProgress.reportDue(millis())) {
+            sendProgressReport();
         }
+        
+        have = more;
+        current = following;
     }
+    
+    streamIngest.end();
+    jobProgress.finish();
+    return !streamIngest.overflowed();  // 넘침은 수신 시점에 이미 알림
 }
 
-// BLE 초기화 태스크
-void bleTask(void * parameter) {
-    // BLE 초기화 - JavaScript와 일치
-    BLEDevice::init("GHOSTYPE");
+// 스니펫 정의/삭제 - GHTYPE_SNP:{"id":3,"text":"Hello {0}"} / {"id":3,"delete":true}
+// text의 offset 위치부터가 정의 (청크로 받은 정의는 내부 청크 헤더 뒤), 반환값은 보낼 응답
+String handleSnippetDefinition(const String& text, size_t offset, uint8_t layout) {
+    const char* snippetJson = text.c_str() + offset + strlen(PROTOCOL_SNIPPET);
+    size_t jsonLength = text.length() - offset - strlen(PROTOCOL_SNIPPET);
+    DynamicJsonDocument doc(jsonLength + 256);
+    DeserializationError error = deserializeJson(doc, snippetJson, jsonLength);
     
-    // MTU 크기 설정 (안정성을 위해 적절한 크기로 조정)
-    BLEDevice::setMTU(247); // 안정성과 호환성을 위해 247로 설정
+    if (error || !doc.containsKey("id")) {
+        return "ERR:INVALID_DATA";
+    }
     
-    // 보안 비활성화
-    esp_ble_auth_req_t auth_req = ESP_LE_AUTH_NO_BOND;
-    esp_ble_io_cap_t iocap = ESP_IO_CAP_NONE;
-    uint8_t key_size = 16;
-    uint8_t init_key = ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK;
-    uint8_t rsp_key = ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK;
-    esp_ble_gap_set_security_param(ESP_BLE_SM_AUTHEN_REQ_MODE, &auth_req, sizeof(uint8_t));
-    esp_ble_gap_set_security_param(ESP_BLE_SM_IOCAP_MODE, &iocap, sizeof(uint8_t));
-    esp_ble_gap_set_security_param(ESP_BLE_SM_MAX_KEY_SIZE, &key_size, sizeof(uint8_t));
-    esp_ble_gap_set_security_param(ESP_BLE_SM_SET_INIT_KEY, &init_key, sizeof(uint8_t));
-    esp_ble_gap_set_security_param(ESP_BLE_SM_SET_RSP_KEY, &rsp_key, sizeof(uint8_t));
+    uint16_t id = doc["id"];
+    bool ok;
+    if (doc["delete"] | false) {
+        ok = SnippetStore::remove(id);
+    } else {
+        // 등록 시 한 번만 컴파일해서 저장 - {0}~{9}는 매개변수 자리
+        const char* snippetText = doc["text"] | "";
+        std::vector<KeyEvent> events;
+        KeystrokeCompiler::compile(snippetText, strlen(snippetText), events, layout, true);
+        ok = SnippetStore::save(id, events);
+    }
     
-    // 서버 생성
-    pServer = BLEDevice::createServer();
-    pServer->setCallbacks(new MyServerCallbacks());
+    return ok ? "OK:SNP:" + String(id) : String("ERR:SNIPPET_STORE");
+}
+
+// 청크로 받은 데이터가 스니펫 정의인지 (BLE 쓰기 한 번보다 긴 정의는 청크로 전송)
+bool isChunkedSnippet(const String& text) {
+    size_t prefix = strlen(PROTOCOL_SNIPPET);
+    return text.length() >= 6 + prefix && strncmp(text.c_str() + 6, PROTOCOL_SNIPPET, prefix) == 0;
+}
+
+// 스니펫 호출 프레임 해석 - [0xFF][0x01][id 하위][id 상위][매개변수0][0x1F][매개변수1]...
+bool expandSnippetInvoke(const String& frame, uint8_t layout, std::vector<KeyEvent>& events) {
+    const uint8_t* data = (const uint8_t*)frame.c_str();
+    size_t length = frame.length();
+    if (length < 4) {
+        return false;
+    }
     
-    // 서비스 생성
-    BLEService *pService = pServer->createService(SERVICE_UUID);
+    uint16_t id = data[2] | (data[3] << 8);
+    std::vector<KeyEvent> snippet;
+    if (!SnippetStore::load(id, snippet)) {
+        return false;
+    }
     
-    // RX 특성
-    pRxCharacteristic = pService->createCharacteristic(
-        RX_CHAR_UUID,
-        BLECharacteristic::PROPERTY_WRITE
-    );
-    pRxCharacteristic->setCallbacks(new MyCallbacks());
+    // 매개변수 컴파일 (0x1F로 구분)
+    std::vector<KeyEvent> params[SNIPPET_MAX_PARAMS];
+    size_t paramCount = 0;
+    size_t start = 4;
+    while (start < length && paramCount < SNIPPET_MAX_PARAMS) {
+        size_t end = start;
+        while (end < length && data[end] != FRAME_PARAM_SEPARATOR) {
+            end++;
+        }
+        KeystrokeCompiler::compile((const char*)data + start, end - start, params[paramCount], layout);
+        paramCount++;
+        start = end + 1;
+    }
     
-    // TX 특성
-    pTxCharacteristic = pService->createCharacteristic(
-        TX_CHAR_UUID,
-        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
-    );
-    pTxCharacteristic->addDescriptor(new BLE2902());
-    
-    // 서비스 시작
-    pService->start();
-    
-    // 광고 시작
-    BLEAdvertising *pAdvertising = BLEDevice::getAdvertising();
-    pAdvertising->addServiceUUID(SERVICE_UUID);
-    pAdvertising->setScanResponse(true);
-    pAdvertising->setMinPreferred(0x06);
-    pAdvertising->setMaxPreferred(0x12);
-    BLEDevice::startAdvertising();
-    
-    DEBUG_PRINTLN("BLE 태스크 시작됨!");
-    
-    // BLE 태스크 루프
-    while(1) {
-        // BLE 상태 체크
-        static unsigned long lastCheck = 0;
-        if (millis() - lastCheck > 10000) {
-            DEBUG_PRINT("BLE 상태: ");
-            DEBUG_PRINTLN(deviceConnected ? "연결됨" : "대기중");
-            lastCheck = millis();
+    KeystrokeCompiler::expandParams(snippet, params, paramCount, events);
+    return true;
+}
+
+// 수신 메시지에서 타이핑할 텍스트 추출 (JSON / 레거시 접두사 / 일반 텍스트)
+// 속도/진행 알림 설정은 작업에 기록해 두고 타이핑을 시작할 때 적용
+String extractTypingText(const String& text, CompiledJob& job, uint8_t& layout) {
+    // JSON 파싱 시도
+    if (text.startsWith("{")) {
+        DEBUG_PRINTLN("=== JSON 파싱 시작 ===");
+        StaticJsonDocument<8192> doc; // 크기를 8KB로 증가
+        DeserializationError error = deserializeJson(doc, text);
+        
+        DEBUG_PRINT("JSON 파싱 결과: ");
+        if (error) {
+            DEBUG_PRINT("실패 - ");
+            DEBUG_PRINTLN(error.c_str());
+            return text; // JSON 파싱 실패시 원본 텍스트 사용
+        }
+        DEBUG_PRINTLN("성공");
+        
+        if (!doc.containsKey("text")) {
+            DEBUG_PRINTLN("JSON에 'text' 키가 없음");
+            return text; // text 키가 없으면 원본 사용
+        }
+        
+        if (doc.containsKey("speed_cps")) {
+            int speed_cps = doc["speed_cps"];
+            job.speed_cps = CLAMP(speed_cps, MIN_TYPING_SPEED_CPS, MAX_TYPING_SPEED_CPS); // 타이핑 시작 시 전역 속도에 반영
+        }
+        if (doc.containsKey(JSON_FIELD_PROGRESS)) {
+            job.progress_ms = doc[JSON_FIELD_PROGRESS].as<unsigned long>();
         }
+        if (doc.containsKey(JSON_FIELD_LAYOUT)) {
+            // 이 작업의 컴파일에만 적용 (클라이언트 배열은 제어 레인의 CFG로만 바뀜)
+            Keymap::fromName(doc[JSON_FIELD_LAYOUT] | "", layout);
+        }
+        return doc["text"].as<String>();
+    }
+    
+    // 레거시 형식 지원 (설정/한영 전환/상태 조회는 제어 레인에서 처리)
+    if (text.startsWith("GHTYPE_KOR:") || text.startsWith("GHTYPE_ENG:")) {
+        return text.substring(11);
+    }
+    return text; // 일반 텍스트
+}
+
+// 벌크 레인 메시지 하나를 해석/컴파일 (컴파일 태스크)
+// 실패하거나 타이핑이 없는 작업도 상태와 응답을 담아 넘김 - 응답 순서와 한영 전환 장벽 수를 유지
+CompiledJob* compileJob(const QueuedMessage& message) {
+    uint32_t started = millis();
+    const String& text = message.data;
+    uint8_t client = message.client;
+    // 클라이언트 상태는 loop()(코어 1)의 CFG만 바꾸므로 복사본으로 컴파일
+    uint8_t clientLayout = clients[client].layout;
+    uint8_t layout = clientLayout;
+    CompiledJob* job = new CompiledJob();
+    job->client = client;
+    job->status = JOB_STATUS_TYPE;
+    job->speed_cps = -1;
+    job->progress_ms = -1;
+    job->chunk = text.length() >= 6 &&
+        (uint8_t)text[0] == FRAME_MARKER && (uint8_t)text[1] == FRAME_CHUNK_JOB;
+    job->chunk_id = 0;
+    job->stream = text.length() == 2 &&
+        (uint8_t)text[0] == FRAME_MARKER && (uint8_t)text[1] == FRAME_STREAM_JOB;
+    if (job->chunk) {
+        const uint8_t* data = (const uint8_t*)text.c_str();
+        job->chunk_id = data[2] | (data[3] << 8) | (data[4] << 16) | ((uint32_t)data[5] << 24);
+    }
+    
+    std::vector<KeyEvent>& events = job->events;
+    uint32_t probeHash = 0;
+    uint32_t probeLength = 0;
+    if (job->stream) {
+        // 이벤트는 수신하면서 StreamIngest가 컴파일 - 타이핑 단계에서 꺼냄
+    } else if (parseCacheProbe(text, probeHash, probeLength)) {
+        // 캐시 적중 - 캐시된 이벤트 열을 원래 작업의 설정(배열, 속도, 진행 알림)으로 재생
+        bool found = false;
+        CachedJobSettings settings;
+        if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+            found = jobCache.fetch(probeHash, probeLength, clientLayout, events, settings);
+            xSemaphoreGive(queueMutex);
+        }
+        if (found) {
+            layout = settings.layout;
+            job->speed_cps = settings.speed_cps;
+            job->progress_ms = settings.progress_ms;
+        } else {
+            job->status = JOB_STATUS_FAILED;
+            job->reply = "ERR:CACHE_EVICTED";
+        }
+    } else if ((uint8_t)text[0] == FRAME_MARKER && !job->chunk) {
+        // 바이너리 프레임 - 저장된 스니펫 재생 (파싱/컴파일 생략)
+        if ((uint8_t)text[1] != FRAME_SNIPPET_INVOKE || !expandSnippetInvoke(text, layout, events)) {
+            job->status = JOB_STATUS_FAILED;
+            job->reply = "ERR:SNIPPET_NOT_FOUND";
+        }
+    } else if (text.startsWith(PROTOCOL_SNIPPET) || (job->chunk && isChunkedSnippet(text))) {
+        job->reply = handleSnippetDefinition(text, job->chunk ? 6 : 0, layout);
+        job->status = job->reply.startsWith("OK:") ? JOB_STATUS_NO_TYPING : JOB_STATUS_FAILED;
+    } else {
+        // 청크 데이터는 수신 시 CRC 검증을 마친 텍스트
+        String textToType = job->chunk ? text.substring(6) : extractTypingText(text, *job, layout);
+        KeystrokeCompiler::compile(textToType.c_str(), textToType.length(), events, layout);
         
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        // 긴 작업은 재시도에 대비해 캐시에 보관 - 조회는 클라이언트 배열로 오므로 그 배열을 키로
+        if (textToType.length() >= JOB_CACHE_MIN_TEXT) {
+            uint32_t hash = JobCache::hashText(textToType.c_str(), textToType.length());
+            CachedJobSettings settings = { layout, job->speed_cps, job->progress_ms };
+            if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+                jobCache.store(hash, textToType.length(), clientLayout, settings, text.length(), events);
+                xSemaphoreGive(queueMutex);
+            }
+        }
+    }
+    
+    job->layout = layout;
+    job->compile_ms = millis() - started;
+    return job;
+}
+
+// 컴파일 태스크 - 타이핑 단계에 자리가 있는 만큼 대량 레인의 작업을 미리 컴파일 (코어 0)
+// 클라이언트가 여럿이면 스케줄러가 가중치 몫대로 번갈아 꺼냄
+void compileTask(void* parameter) {
+    while (true) {
+        while (jobPipeline.hasSpace()) {
+            QueuedMessage message;
+            bool found = false;
+            if (xSemaphoreTake(queueMutex, portMAX_DELAY) == pdTRUE) {
+                found = bulkScheduler.pop(message, millis());
+                xSemaphoreGive(queueMutex);
+            }
+            if (!found) {
+                break;
+            }
+            jobPipeline.submit(compileJob(message));
+        }
+        // 새 작업 수신 또는 타이핑 단계에 자리가 생기면 깨어남
+        jobPipeline.waitForWork(PIPELINE_IDLE_WAIT_MS);
+    }
+}
+
+// 타이핑 작업 처리 - 컴파일이 끝난 작업을 꺼내 HID로 출력 (코어 1)
+void processTypingQueue() {
+    CompiledJob* job = jobPipeline.take();
+    if (!job) {
+        return;
+    }
+    
+    if (job->status != JOB_STATUS_TYPE) {
+        // 타이핑 없이 응답만 - 완료 수는 세어 한영 전환 장벽을 풀되 완료 응답은 보내지 않음
+        bulkJobsCompleted[job->client]++;
+        sendNotify(job->client, job->reply);
+        if (job->chunk) {
+            sendNotify(job->client, "ACK:" + String((unsigned long)job->chunk_id));  // 청크는 받았음
+        }
+        delete job;
+        return;
+    }
+    
+    // 타이핑 시작 - 작업을 보낸 클라이언트의 설정으로, 작업에 지정된 설정은 이 작업부터 적용
+    ClientState& state = clients[job->client];
+    activeClient = job->client;
+    isTyping = true;
+    jobPipeline.recordGap(millis() - lastTypeTime);
+    if (job->speed_cps >= 0) {
+        state.typing_speed = job->speed_cps;
+        DEBUG_PRINT("JSON에서 타이핑 속도 업데이트: ");
+        DEBUG_PRINTLN(state.typing_speed);
+    }
+    if (job->progress_ms >= 0) {
+        state.progress_ms = job->progress_ms;
+    }
+    globalTypingSpeed = state.typing_speed;
+    activeLayout = job->layout;
+    jobProgress.setInterval(state.progress_ms);
+    
+    // 실제 타이핑
+    bool completed = true;
+    if (job->stream) {
+        completed = typeStreamJob();
+    } else if (!job->events.empty()) {
+        typeKeyEvents(job->events);
+    }
+    
+    DEBUG_PRINTLN("타이핑 완료!");
+    isTyping = false;
+    lastTypeTime = millis();
+    bulkJobsCompleted[job->client]++;
+    
+    // 완료 응답 전송 (청크는 번호로 ACK)
+    if (job->chunk) {
+        sendNotify(job->client, "ACK:" + String((unsigned long)job->chunk_id));
+    } else if (completed) {
+        sendNotify(job->client, "OK:Typing completed");
     }
+    delete job;
 }
 
 void setup() {
-    #if DEBUG_ENABLED
+    BootProfile::mark(BOOT_PHASE_SETUP);
+    
+    #ifdef DEBUG_MODE
     Serial.begin(115200);
-    delay(2000);
+    // 시리얼 모니터가 열릴 때까지만 기다림 (고정 2초 대기 대체)
+    while (!Serial && millis() < BOOT_SERIAL_WAIT_MS) {
+        delay(10);
+    }
     #endif
     
     DEBUG_PRINTLN("\n=== GHOSTYPE 실시간 BLE + HID ===");
     DEBUG_PRINTLN("BLE로 받은 텍스트를 즉시 USB 키보드로 타이핑합니다.");
     
-    // 큐 뮤텍스 생성
+    // 수신 콜백이 쓰는 것만 먼저 준비 - 큐 뮤텍스, 라이브 미러 키 큐, 스트리밍 수신 링 버퍼,
+    // 클라이언트별 세션과 대량 레인 (클라이언트 번호 = 경로 순서)
     queueMutex = xSemaphoreCreateMutex();
+    ingestMutex = xSemaphoreCreateMutex();
+    mirrorSession.initialize();
+    streamIngest.initialize();
+    for (size_t i = 0; i < TRANSPORT_COUNT; i++) {
+        clients[i].session.initialize();
+        bulkScheduler.addClient(transports[i]->name());
+    }
+    BootProfile::mark(BOOT_PHASE_LANES);
     
-    // USB HID 초기화
-    DEBUG_PRINTLN("1. USB HID 키보드 초기화...");
+    // 수신 경로 시작 - BLE 스택 초기화(가장 오래 걸림)가 코어 0에서 도는 동안
+    // 이 코어(1)에서 USB HID, 저장소, 컴파일 태스크를 준비
+    // 그 사이 도착한 작업은 벌크 레인에 쌓였다가 컴파일 태스크가 시작되면 처리됨
+    DEBUG_PRINTLN("1. 수신 경로 시작...");
+    for (ITransport* transport : transports) {
+        transport->begin(onTransportReceive, onTransportConnection);
+    }
+    BootProfile::mark(BOOT_PHASE_TRANSPORTS);
+    
+    // USB HID 초기화 - 열거는 기다리지 않고 이벤트로 기록 (타이핑은 hidReady()가 막음)
+    DEBUG_PRINTLN("2. USB HID 키보드 초기화...");
+    USB.onEvent(ARDUINO_USB_STARTED_EVENT, onUsbEvent);
     USB.begin();
     keyboard.begin();
-    DEBUG_PRINTLN("   ✓ HID 초기화 완료");
+    keyboard.onEvent(ARDUINO_USB_HID_KEYBOARD_LED_EVENT, onKeyboardLed);
+    BootProfile::mark(BOOT_PHASE_HID);
     
-    // BLE를 별도 태스크로 실행
-    DEBUG_PRINTLN("2. BLE 태스크 생성...");
+    // 스니펫 저장소 (NVS) - 컴파일 태스크보다 먼저
+    SnippetStore::initialize();
+    BootProfile::mark(BOOT_PHASE_STORAGE);
+    
+    // 컴파일 태스크 (코어 0, BLE 스택보다 낮은 우선순위) - HID 출력은 loop()(코어 1)
+    TaskHandle_t compileTaskHandle = NULL;
     xTaskCreatePinnedToCore(
-        bleTask,          // 태스크 함수
-        "BLE_Task",       // 태스크 이름
-        8192,             // 스택 크기
-        NULL,             // 파라미터
-        1,                // 우선순위
-        NULL,             // 태스크 핸들
-        0                 // CPU 코어 (0번 코어)
+        compileTask,                // 태스크 함수
+        "Compile_Task",             // 태스크 이름
+        PIPELINE_COMPILE_STACK,     // 스택 크기 (JSON 문서 포함)
+        NULL,                       // 파라미터
+        PIPELINE_COMPILE_PRIORITY,  // 우선순위
+        &compileTaskHandle,         // 태스크 핸들
+        0                           // CPU 코어 (0번 코어)
     );
+    jobPipeline.initialize(compileTaskHandle);
+    BootProfile::mark(BOOT_PHASE_READY);
     
-    DEBUG_PRINTLN("   ✓ BLE 태스크 생성 완료");
     DEBUG_PRINTLN("\n준비 완료! BLE 연결을 기다립니다...\n");
 }
 
 void loop() {
     // 메인 루프는 HID 타이핑 처리에 집중
     
-    // 타이핑 큐 처리
-    if (!typingQueue.empty()) {
+    // 제어 레인은 항상 먼저 처리
+    serviceControlLane();
+    
+    // 컴파일이 끝난 작업 타이핑
+    if (jobPipeline.ready() > 0 && hidReady()) {
         // 이전 타이핑 완료 후 약간의 딜레이
         if (millis() - lastTypeTime > 100) {
             processTypingQueue();
         }
     }
     
-    // CPU 부하 감소
-    delay(10);
+    // 미러 키를 기다리며 쉼 - 키가 오면 즉시 깨어나 입력 (CPU 부하 감소 겸용)
+    serviceMirror(MIRROR_IDLE_WAIT_MS);
 }
\ No newline at end of file
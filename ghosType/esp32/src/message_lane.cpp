@@ -0,0 +1,93 @@
+/**
+ * @file message_lane.cpp
+ * @brief 우선순위별 수신 메시지 대기열 (레인) 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "message_lane.h"
+
+MessageLane::MessageLane(const char* name, size_t capacity, size_t byte_limit)
+    : lane_name(name), max_items(capacity), max_bytes(byte_limit), queued_bytes(0), lane_stats() {
+}
+
+bool MessageLane::push(const String& data, uint32_t now_ms, uint32_t barrier, uint8_t client) {
+    if (items.size() >= max_items ||
+        (max_bytes > 0 && !items.empty() && queued_bytes + data.length() > max_bytes)) {
+        lane_stats.dropped++;
+        return false;
+    }
+
+    QueuedMessage message;
+    message.data = data;
+    message.enqueued_at = now_ms;
+    message.barrier = barrier;
+    message.client = client;
+    items.push_back(message);
+    queued_bytes += data.length();
+
+    lane_stats.enqueued++;
+    if (items.size() > lane_stats.peak_depth) {
+        lane_stats.peak_depth = items.size();
+    }
+    return true;
+}
+
+bool MessageLane::pop(QueuedMessage& out, uint32_t now_ms) {
+    if (items.empty()) {
+        return false;
+    }
+
+    out = items.front();
+    items.pop_front();
+    recordWait(out, now_ms);
+    return true;
+}
+
+bool MessageLane::popReady(QueuedMessage& out, uint32_t now_ms, const uint32_t* completed) {
+    for (std::deque<QueuedMessage>::iterator it = items.begin(); it != items.end(); ++it) {
+        if (it->barrier <= completed[it->client]) {
+            out = *it;
+            items.erase(it);
+            recordWait(out, now_ms);
+            return true;
+        }
+    }
+    return false;
+}
+
+void MessageLane::recordWait(const QueuedMessage& message, uint32_t now_ms) {
+    queued_bytes -= message.data.length();
+    uint32_t waited = now_ms - message.enqueued_at;
+    lane_stats.dequeued++;
+    lane_stats.last_wait_ms = waited;
+    lane_stats.total_wait_ms += waited;
+    if (waited > lane_stats.max_wait_ms) {
+        lane_stats.max_wait_ms = waited;
+    }
+}
+
+String MessageLane::statsJson() const {
+    uint32_t avg_wait = lane_stats.dequeued > 0 ? lane_stats.total_wait_ms / lane_stats.dequeued : 0;
+
+    String json = "{\"depth\":";
+    json += (unsigned int)items.size();
+    json += ",\"cap\":";
+    json += (unsigned int)max_items;
+    json += ",\"bytes\":";
+    json += (unsigned int)queued_bytes;
+    json += ",\"in\":";
+    json += lane_stats.enqueued;
+    json += ",\"out\":";
+    json += lane_stats.dequeued;
+    json += ",\"drop\":";
+    json += lane_stats.dropped;
+    json += ",\"peak\":";
+    json += lane_stats.peak_depth;
+    json += ",\"wait_max\":";
+    json += lane_stats.max_wait_ms;
+    json += ",\"wait_avg\":";
+    json += avg_wait;
+    json += "}";
+    return json;
+}
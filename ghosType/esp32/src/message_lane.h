@@ -0,0 +1,113 @@
+/**
+ * @file message_lane.h
+ * @brief 우선순위별 수신 메시지 대기열 (레인)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * BLE로 수신된 메시지를 용도별 레인에 나누어 보관합니다.
+ * 제어 레인(설정 변경, 한영 전환, 상태 조회)은 키 입력 사이마다 먼저 처리되고,
+ * 벌크 레인(텍스트 작업)은 이전 작업이 끝난 뒤 순서대로 처리됩니다.
+ * 각 레인은 자체 용량과 통계를 가집니다. 벌크 레인은 클라이언트마다 하나씩 있고
+ * (client_scheduler.h), 제어 레인은 모든 클라이언트가 함께 쓰며 메시지마다 보낸 클라이언트를 기록합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <deque>
+#include "config.h"
+
+/**
+ * @brief 레인에 보관되는 메시지
+ */
+struct QueuedMessage {
+    String data;              ///< 수신된 원본 메시지
+    uint32_t enqueued_at;     ///< 레인에 들어온 시각 (밀리초)
+    uint32_t barrier;         ///< 보낸 클라이언트의 벌크 작업이 이만큼 끝난 뒤에 실행 (0: 즉시)
+    uint8_t client;           ///< 보낸 클라이언트 (수신 경로 번호)
+};
+
+/**
+ * @brief 레인 통계 구조체
+ */
+struct LaneStats {
+    uint32_t enqueued;        ///< 누적 추가 개수
+    uint32_t dequeued;        ///< 누적 처리 개수
+    uint32_t dropped;         ///< 용량 초과로 거부된 개수
+    uint16_t peak_depth;      ///< 최대 대기 개수
+    uint32_t last_wait_ms;    ///< 마지막 메시지의 대기 시간
+    uint32_t max_wait_ms;     ///< 최대 대기 시간
+    uint32_t total_wait_ms;   ///< 누적 대기 시간 (평균 계산용)
+};
+
+/**
+ * @brief 고정 용량 FIFO 메시지 레인
+ *
+ * 동기화는 호출하는 쪽에서 담당합니다 (main.cpp의 queueMutex).
+ */
+class MessageLane {
+public:
+    /**
+     * @brief 레인 생성
+     * @param name 상태 보고에 사용할 레인 이름
+     * @param capacity 최대 보관 개수
+     * @param max_bytes 최대 보관 바이트 (0: 제한 없음, 비어 있으면 한도보다 큰 메시지 하나는 받음)
+     */
+    MessageLane(const char* name, size_t capacity, size_t max_bytes = 0);
+
+    /**
+     * @brief 메시지 추가
+     * @param data 수신된 메시지
+     * @param now_ms 현재 시각 (밀리초)
+     * @param barrier 실행 전에 완료되어야 하는 보낸 클라이언트의 벌크 작업 수 (0: 즉시 실행 가능)
+     * @param client 보낸 클라이언트
+     * @return true 추가됨, false 용량 초과로 거부
+     */
+    bool push(const String& data, uint32_t now_ms, uint32_t barrier = 0, uint8_t client = 0);
+
+    /**
+     * @brief 가장 오래된 메시지 꺼내기
+     * @param[out] out 꺼낸 메시지
+     * @param now_ms 현재 시각 (대기 시간 통계용)
+     * @return true 꺼냄, false 비어 있음
+     */
+    bool pop(QueuedMessage& out, uint32_t now_ms);
+
+    /**
+     * @brief 실행 가능한 가장 오래된 메시지 꺼내기
+     * @param[out] out 꺼낸 메시지
+     * @param now_ms 현재 시각 (대기 시간 통계용)
+     * @param completed 클라이언트별 지금까지 완료된 벌크 작업 수 (클라이언트 번호로 색인)
+     * @return true 꺼냄, false 실행 가능한 메시지 없음
+     *
+     * 순서가 중요한 명령(한영 전환)은 같은 클라이언트의 앞선 텍스트가 모두 타이핑될 때까지
+     * 남겨두고, 그 뒤의 설정 변경이나 상태 조회는 먼저 꺼냅니다.
+     */
+    bool popReady(QueuedMessage& out, uint32_t now_ms, const uint32_t* completed);
+
+    bool empty() const { return items.empty(); }
+    size_t size() const { return items.size(); }
+    size_t bytes() const { return queued_bytes; }
+    size_t capacity() const { return max_items; }
+    const char* name() const { return lane_name; }
+    const LaneStats& stats() const { return lane_stats; }
+
+    /**
+     * @brief 레인 상태를 JSON 객체 문자열로 변환
+     * @return 예: {"depth":0,"cap":16,"bytes":0,"in":3,"out":3,"drop":0,"peak":1,"wait_max":12,"wait_avg":4}
+     */
+    String statsJson() const;
+
+private:
+    const char* lane_name;               ///< 레인 이름
+    size_t max_items;                    ///< 최대 보관 개수
+    size_t max_bytes;                    ///< 최대 보관 바이트 (0: 제한 없음)
+    size_t queued_bytes;                 ///< 보관 중인 메시지 바이트
+    std::deque<QueuedMessage> items;     ///< 보관 중인 메시지
+    LaneStats lane_stats;                ///< 통계
+
+    /**
+     * @brief 꺼낸 메시지의 대기 시간 통계 갱신
+     */
+    void recordWait(const QueuedMessage& message, uint32_t now_ms);
+};
@@ -0,0 +1,133 @@
+/**
+ * @file mirror_session.cpp
+ * @brief 라이브 미러 모드 - 글자 단위 저지연 스트리밍 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "mirror_session.h"
+
+// 히스토그램 구간 상한 (마이크로초) - 마지막 구간은 그 이상
+static const uint32_t LATENCY_BOUNDS_US[MIRROR_LATENCY_BUCKETS - 1] = { MIRROR_LATENCY_BOUNDS_US };
+
+MirrorSession::MirrorSession()
+    : queue(NULL), is_open(false), layout(LAYOUT_US), context{ IME_MODE_UNKNOWN, 0 }, last_error("OK"),
+      frames(0), keys(0), dropped(0), max_latency_us(0) {
+    memset(histogram, 0, sizeof(histogram));
+}
+
+void MirrorSession::initialize() {
+    queue = xQueueCreate(MIRROR_QUEUE_LENGTH, sizeof(MirrorKey));
+    scratch.reserve(MIRROR_QUEUE_LENGTH);
+}
+
+void MirrorSession::open(uint8_t host_layout) {
+    layout = host_layout;
+    context.mode = IME_MODE_UNKNOWN;
+    context.previous_syllable = 0;
+    shadow.clear();
+    frames = 0;
+    keys = 0;
+    dropped = 0;
+    max_latency_us = 0;
+    memset(histogram, 0, sizeof(histogram));
+    is_open = true;
+}
+
+void MirrorSession::close() {
+    is_open = false;
+}
+
+bool MirrorSession::push(const char* text, size_t length) {
+    return edit(shadow.cursor(), shadow.cursor(), text, length);
+}
+
+bool MirrorSession::edit(uint32_t start, uint32_t end, const char* text, size_t length) {
+    if (!is_open || !queue) {
+        last_error = "ERR:MIRROR_CLOSED";
+        return false;
+    }
+    uint32_t now = micros();
+    frames++;
+
+    scratch.clear();
+    if (!shadow.replace(start, end, text, length, layout, context, scratch)) {
+        last_error = "ERR:EDIT_RANGE";
+        return false;
+    }
+    return enqueue(now);
+}
+
+bool MirrorSession::enqueue(uint32_t received_us) {
+    for (size_t i = 0; i < scratch.size(); i++) {
+        MirrorKey key = { scratch[i], received_us };
+        if (xQueueSend(queue, &key, 0) != pdTRUE) {
+            // 사본은 이미 갱신되었으므로 클라이언트가 세션을 다시 시작해야 함
+            dropped += scratch.size() - i;
+            last_error = "ERR:QUEUE_FULL";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MirrorSession::pop(MirrorKey& key, uint32_t wait_ms) {
+    if (!queue) {
+        if (wait_ms > 0) {
+            delay(wait_ms);
+        }
+        return false;
+    }
+    return xQueueReceive(queue, &key, pdMS_TO_TICKS(wait_ms)) == pdTRUE;
+}
+
+void MirrorSession::recordLatency(uint32_t latency_us) {
+    keys++;
+    if (latency_us > max_latency_us) {
+        max_latency_us = latency_us;
+    }
+    size_t bucket = 0;
+    while (bucket < MIRROR_LATENCY_BUCKETS - 1 && latency_us >= LATENCY_BOUNDS_US[bucket]) {
+        bucket++;
+    }
+    histogram[bucket]++;
+}
+
+String MirrorSession::statsJson() const {
+    String json = "{\"open\":";
+    json += is_open ? "true" : "false";
+    json += ",\"frames\":";
+    json += frames;
+    json += ",\"keys\":";
+    json += keys;
+    json += ",\"dropped\":";
+    json += dropped;
+    json += ",\"max_us\":";
+    json += max_latency_us;
+    json += ",\"hist\":[";
+    for (size_t i = 0; i < MIRROR_LATENCY_BUCKETS; i++) {
+        if (i > 0) {
+            json += ",";
+        }
+        json += histogram[i];
+    }
+    json += "],\"bounds_us\":[";
+    for (size_t i = 0; i < MIRROR_LATENCY_BUCKETS - 1; i++) {
+        if (i > 0) {
+            json += ",";
+        }
+        json += LATENCY_BOUNDS_US[i];
+    }
+    json += "],\"cursor\":";
+    json += shadow.cursor();
+    json += ",\"length\":";
+    json += shadow.end();
+    json += ",\"edits\":";
+    json += shadow.stats().edits;
+    json += ",\"edit_keys\":";
+    json += shadow.stats().keys;
+    json += ",\"retype_keys\":";
+    json += shadow.stats().retype_keys;
+    json += "}";
+    return json;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file mirror_session.h
+ * @brief 라이브 미러 모드 - 글자 단위 저지연 스트리밍
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 휴대폰에서 입력하는 글자를 하나씩 그대로 따라 치는 모드입니다.
+ * 일반 작업은 메시지마다 String 복사, 레인 대기, JSON 해석, 작업 사이 간격을 거치지만
+ * 미러 프레임은 BLE 수신 콜백에서 바로 키 이벤트로 컴파일되어 FreeRTOS 큐로
+ * HID 루프에 전달되고, HID 루프는 큐를 기다리다 키가 오는 즉시 입력합니다.
+ *
+ * 수신부터 HID 리포트 전송까지의 지연을 히스토그램으로 집계해 상태 보고에 포함합니다.
+ * 입력한 텍스트의 사본(shadow_text.h)을 유지하므로 클라이언트가 앞부분을 고치면
+ * 다시 입력하지 않고 커서 이동/지우기/삽입만으로 반영합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "config.h"
+#include "keystroke_compiler.h"
+#include "shadow_text.h"
+
+/**
+ * @brief HID 루프로 전달되는 미러 키
+ */
+struct MirrorKey {
+    KeyEvent event;           ///< 입력할 키
+    uint32_t received_us;     ///< 프레임 수신 시각 (micros)
+};
+
+/**
+ * @brief 미러 지연 히스토그램 구간 수 (MIRROR_LATENCY_BOUNDS_US + 초과 구간)
+ */
+constexpr size_t MIRROR_LATENCY_BUCKETS = 8;
+
+/**
+ * @brief 라이브 미러 세션 클래스
+ *
+ * open/close/push는 BLE 태스크, pop/recordLatency는 HID 루프에서 호출합니다.
+ * 두 태스크 사이의 전달은 FreeRTOS 큐가 담당합니다.
+ */
+class MirrorSession {
+public:
+    MirrorSession();
+
+    /**
+     * @brief 큐 생성 (setup에서 한 번)
+     */
+    void initialize();
+
+    /**
+     * @brief 세션 시작 - 한영 모드/음절 상태와 히스토그램 초기화
+     * @param layout 호스트 키보드 배열
+     */
+    void open(uint8_t layout);
+
+    /**
+     * @brief 세션 종료 (큐에 남은 키는 그대로 입력됨)
+     */
+    void close();
+
+    bool isOpen() const { return is_open; }
+
+    /**
+     * @brief 미러 프레임의 텍스트를 커서 위치에 입력하도록 HID 루프로 전달
+     * @param text UTF-8 텍스트
+     * @param length 바이트 길이
+     * @return false 세션이 닫혀 있거나 큐가 가득 차 일부 키를 버림
+     */
+    bool push(const char* text, size_t length);
+
+    /**
+     * @brief 이미 입력한 텍스트의 [start, end)를 text로 바꾸는 키를 HID 루프로 전달
+     * @param start 바꿀 범위 시작 (코드 포인트)
+     * @param end 바꿀 범위 끝 (코드 포인트)
+     * @param text 새 텍스트 (UTF-8)
+     * @param length 바이트 길이
+     * @return false 세션이 닫혀 있거나, 범위가 잘못되었거나, 큐가 가득 참 (lastError 참고)
+     */
+    bool edit(uint32_t start, uint32_t end, const char* text, size_t length);
+
+    /**
+     * @brief 마지막 push/edit 실패 사유 (응답용)
+     */
+    const char* lastError() const { return last_error; }
+
+    /**
+     * @brief 다음 미러 키 대기
+     * @param[out] key 받은 키
+     * @param wait_ms 최대 대기 시간 (0: 기다리지 않음)
+     * @return true 키를 받음
+     */
+    bool pop(MirrorKey& key, uint32_t wait_ms);
+
+    /**
+     * @brief 키 하나의 수신 → HID 전송 지연 기록
+     * @param latency_us 지연 (마이크로초)
+     */
+    void recordLatency(uint32_t latency_us);
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"open":b,"frames":n,"keys":n,"dropped":n,"max_us":n,"hist":[n,...],"bounds_us":[n,...],
+     *          "cursor":n,"length":n,"edits":n,"edit_keys":n,"retype_keys":n}
+     */
+    String statsJson() const;
+
+private:
+    /**
+     * @brief scratch의 키를 큐에 넣음
+     */
+    bool enqueue(uint32_t received_us);
+
+    QueueHandle_t queue;
+    volatile bool is_open;
+    uint8_t layout;
+    CompileContext context;        ///< 프레임 사이에 이어지는 한영 모드/앞 음절
+    std::vector<KeyEvent> scratch; ///< 컴파일 버퍼 (BLE 태스크 전용, 용량 재사용)
+    ShadowText shadow;             ///< 입력한 텍스트 사본 (BLE 태스크 전용)
+    const char* last_error;
+    uint32_t frames;
+    uint32_t keys;
+    uint32_t dropped;
+    uint32_t max_latency_us;
+    uint32_t histogram[MIRROR_LATENCY_BUCKETS];
+};
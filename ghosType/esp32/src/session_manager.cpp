@@ -0,0 +1,115 @@
+/**
+ * @file session_manager.cpp
+ * @brief 세션 토큰 기반 재연결 상태 유지 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "session_manager.h"
+
+SessionManager::SessionManager()
+    : lock(NULL), owner(NULL), session_token(0), disconnected_at(0), owner_dropped(false), connected_at(0),
+      opened(0), resumes(0), expirations(0), dropped(0), last_offline_ms(0), last_resume_ms(0), max_resume_ms(0) {
+}
+
+void SessionManager::initialize() {
+    lock = xSemaphoreCreateMutex();
+}
+
+void SessionManager::connectionChanged(ITransport& transport, bool connected) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    uint32_t now = millis();
+    if (connected) {
+        connected_at = now;
+    } else if (&transport == owner) {
+        disconnected_at = now;
+        owner_dropped = true;
+    }
+    xSemaphoreGive(lock);
+}
+
+void SessionManager::expireIfStale(uint32_t now) {
+    if (owner && owner_dropped && !owner->connected() && now - disconnected_at > SESSION_RESUME_WINDOW_MS) {
+        owner = NULL;
+        session_token = 0;
+        held.clear();
+        expirations++;
+    }
+}
+
+bool SessionManager::hold(const String& message) {
+    if (!owner || owner->connected()) {
+        return false;  // 빠른 경로 - 세션이 없거나 주인이 연결되어 있음
+    }
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return false;
+    }
+    expireIfStale(millis());
+    bool kept = owner && !owner->connected();
+    if (kept && !message.startsWith("PRG:")) {
+        // 진행 알림은 재개 응답의 작업 진행으로 대신하므로 보관하지 않음
+        if (held.size() >= SESSION_HELD_MAX) {
+            held.pop_front();
+            dropped++;
+        }
+        held.push_back(message);
+    }
+    xSemaphoreGive(lock);
+    return kept;
+}
+
+bool SessionManager::open(ITransport& transport, uint32_t token, std::vector<String>& out) {
+    if (xSemaphoreTake(lock, portMAX_DELAY) != pdTRUE) {
+        return false;
+    }
+    uint32_t now = millis();
+    expireIfStale(now);
+
+    bool resumed = token != 0 && token == session_token;
+    if (resumed) {
+        resumes++;
+        last_offline_ms = owner_dropped ? connected_at - disconnected_at : 0;
+        last_resume_ms = owner_dropped ? now - connected_at : 0;
+        if (last_resume_ms > max_resume_ms) {
+            max_resume_ms = last_resume_ms;
+        }
+        out.assign(held.begin(), held.end());
+    } else {
+        opened++;
+        do {
+            session_token = esp_random();
+        } while (session_token == 0);
+    }
+    held.clear();
+    owner = &transport;
+    owner_dropped = false;
+    xSemaphoreGive(lock);
+    return resumed;
+}
+
+String SessionManager::statsJson() const {
+    char token_text[12];
+    snprintf(token_text, sizeof(token_text), "%08lx", (unsigned long)session_token);
+    String json = "{\"token\":\"";
+    json += session_token ? token_text : "";
+    json += "\",\"opened\":";
+    json += opened;
+    json += ",\"resumes\":";
+    json += resumes;
+    json += ",\"expired\":";
+    json += expirations;
+    json += ",\"held\":";
+    json += (unsigned int)held.size();
+    json += ",\"dropped\":";
+    json += dropped;
+    json += ",\"offline_ms\":";
+    json += last_offline_ms;
+    json += ",\"resume_ms\":";
+    json += last_resume_ms;
+    json += ",\"max_resume_ms\":";
+    json += max_resume_ms;
+    json += "}";
+    return json;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file session_manager.h
+ * @brief 연결이 잠깐 끊겨도 이어서 쓰도록 세션 토큰으로 상태를 유지
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 속도, 배열, 진행 중인 작업, 청크/스트림 조립 상태는 장치에 있어 연결이 끊겨도
+ * 그대로 남지만, 다시 연결한 클라이언트는 장치가 어디까지 받았는지 모르고
+ * 끊긴 동안 보낸 응답(완료 알림 등)도 잃습니다.
+ *
+ * 클라이언트는 연결 직후 GHTYPE_SES:{}로 토큰을 받고, 다시 연결하면 그 토큰으로
+ * GHTYPE_SES:{"token":"1a2b3c4d"}를 보냅니다. 토큰이 살아 있으면 재개로 보고
+ * 응답에 스트림 수신 바이트, 조립 중인 청크 위치, 작업 진행을 담아 보내므로
+ * 클라이언트는 그 위치부터 이어 보냅니다. 세션 주인 경로가 끊겨 있는 동안의 응답은
+ * SESSION_HELD_MAX개까지 보관했다가 재개 응답 뒤에 차례로 다시 보냅니다.
+ * 끊긴 뒤 SESSION_RESUME_WINDOW_MS가 지나면 세션은 사라지고 다음 요청은 새 세션이 됩니다.
+ *
+ * 세션은 클라이언트(수신 경로)마다 하나씩 둡니다 (main.cpp의 ClientState).
+ *
+ * 연결 알림(각 경로 태스크/콜백), 응답 보관(응답을 보내는 모든 태스크), 세션 요청
+ * (수신 경로)이 서로 다른 태스크에서 오므로 내부 상태는 뮤텍스로 보호합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "config.h"
+#include "transport.h"
+
+/**
+ * @brief 세션 관리 클래스
+ */
+class SessionManager {
+public:
+    SessionManager();
+
+    /**
+     * @brief 뮤텍스 생성 (setup에서 수신 경로 시작 전에 한 번)
+     */
+    void initialize();
+
+    /**
+     * @brief 경로 연결/해제 기록 (재연결 → 재개 시간, 끊김 시간 측정)
+     */
+    void connectionChanged(ITransport& transport, bool connected);
+
+    /**
+     * @brief 응답 보관 - 세션 주인 경로가 끊겨 있으면 보관
+     * @param message 보낼 응답
+     * @return true 주인이 끊겨 있어 보관함 (진행 알림은 보관하지 않고 버림)
+     */
+    bool hold(const String& message);
+
+    /**
+     * @brief 세션 시작 또는 재개
+     * @param transport 요청이 들어온 경로 (이후 응답 보관 기준)
+     * @param token 클라이언트가 보낸 토큰 (0: 새 세션)
+     * @param[out] held 재개하면 끊긴 동안 보관한 응답 (보낸 순서)
+     * @return true 기존 세션 재개, false 새 세션 (토큰이 없거나 만료됨)
+     */
+    bool open(ITransport& transport, uint32_t token, std::vector<String>& held);
+
+    uint32_t token() const { return session_token; }
+
+    /**
+     * @brief 마지막 재개의 끊김 → 재연결 시간 (끊기지 않고 다시 요청했으면 0)
+     */
+    uint32_t offlineMs() const { return last_offline_ms; }
+
+    /**
+     * @brief 마지막 재개의 재연결 → 세션 요청 시간
+     */
+    uint32_t resumeMs() const { return last_resume_ms; }
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"token":"1a2b3c4d","opened":n,"resumes":n,"expired":n,"held":n,"dropped":n,
+     *          "offline_ms":n,"resume_ms":n,"max_resume_ms":n}
+     */
+    String statsJson() const;
+
+private:
+    /**
+     * @brief 주인이 끊긴 채 유지 시간을 넘겼으면 세션 정리 (lock을 잡은 상태에서 호출)
+     */
+    void expireIfStale(uint32_t now);
+
+    SemaphoreHandle_t lock;
+    ITransport* owner;            ///< 세션을 연 경로 (NULL: 세션 없음)
+    uint32_t session_token;       ///< 0: 세션 없음
+    uint32_t disconnected_at;     ///< 주인 경로가 끊긴 시각
+    bool owner_dropped;           ///< 주인 경로가 세션을 연 뒤 끊긴 적이 있음
+    uint32_t connected_at;        ///< 아무 경로든 마지막으로 연결된 시각
+    std::deque<String> held;      ///< 끊긴 동안 보관한 응답
+
+    uint32_t opened;              ///< 새로 연 세션 수
+    uint32_t resumes;             ///< 재개한 세션 수
+    uint32_t expirations;         ///< 유지 시간을 넘겨 사라진 세션 수
+    uint32_t dropped;             ///< 보관 한도를 넘겨 버린 응답 수
+    uint32_t last_offline_ms;
+    uint32_t last_resume_ms;
+    uint32_t max_resume_ms;
+};
@@ -0,0 +1,156 @@
+/**
+ * @file shadow_text.cpp
+ * @brief 라이브 미러로 입력한 텍스트의 사본과 편집 → 최소 키 입력 변환 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "shadow_text.h"
+#include <string.h>
+
+// 호스트에 입력되지 않은 글자 표시 비트
+static const uint32_t SHADOW_ABSENT = 0x80000000u;
+
+// 편집용 HID 키
+static const uint8_t HID_USAGE_BACKSPACE = 0x2A;
+static const uint8_t HID_USAGE_DELETE = 0x4C;
+static const uint8_t HID_USAGE_RIGHT_ARROW = 0x4F;
+static const uint8_t HID_USAGE_LEFT_ARROW = 0x50;
+
+ShadowText::ShadowText() : origin(0), cursor_index(0), composing(false) {
+    memset(&edit_stats, 0, sizeof(edit_stats));
+}
+
+void ShadowText::clear() {
+    chars.clear();
+    origin = 0;
+    cursor_index = 0;
+    composing = false;
+    memset(&edit_stats, 0, sizeof(edit_stats));
+}
+
+size_t ShadowText::presentBetween(size_t from, size_t to) const {
+    size_t count = 0;
+    for (size_t i = from; i < to; i++) {
+        if (!(chars[i] & SHADOW_ABSENT)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void ShadowText::pushKeys(std::vector<KeyEvent>& out, uint8_t usage, size_t count) {
+    KeyEvent key = { KEY_EVENT_CHAR, usage, 0, JAMO_ROLE_NONE };
+    out.insert(out.end(), count, key);
+}
+
+bool ShadowText::replace(uint32_t start, uint32_t finish, const char* text, size_t length,
+                         uint8_t layout, CompileContext& context, std::vector<KeyEvent>& out) {
+    if (start > finish || start < origin || finish > end()) {
+        return false;
+    }
+    size_t before = out.size();
+    size_t a = start - origin;
+    size_t b = finish - origin;
+
+    // 새 텍스트를 코드 포인트로 풀고 위치 기록 (잘못된 바이트는 버림)
+    new_chars.clear();
+    new_offsets.clear();
+    size_t i = 0;
+    while (i < length) {
+        size_t offset = i;
+        uint32_t code_point = KeystrokeCompiler::decodeUtf8(text, length, i);
+        if (code_point != 0xFFFFFFFF) {
+            new_chars.push_back(code_point);
+            new_offsets.push_back(offset);
+        }
+    }
+    new_offsets.push_back(length);
+    size_t p = 0;
+    size_t q = new_chars.size();
+
+    // 바꾸기 전 호스트 텍스트에서 바뀐 위치 뒤의 글자 수 (다시 입력 비용 비교용)
+    size_t retype = presentBetween(a, chars.size());
+
+    // 바뀌지 않은 앞뒤 부분은 건드리지 않음
+    while (a < b && p < q && (chars[a] & ~SHADOW_ABSENT) == new_chars[p]) {
+        a++;
+        p++;
+    }
+    while (b > a && q > p && (chars[b - 1] & ~SHADOW_ABSENT) == new_chars[q - 1]) {
+        b--;
+        q--;
+    }
+
+    size_t deletes = presentBetween(a, b);
+    bool edited = deletes > 0 || p < q;
+    if (edited) {
+        // 범위 끝으로 가서 Backspace, 범위 시작으로 가서 Delete 중 커서 이동이 적은 쪽
+        size_t to_end = b >= cursor_index ? presentBetween(cursor_index, b) : presentBetween(b, cursor_index);
+        size_t to_start = a >= cursor_index ? presentBetween(cursor_index, a) : presentBetween(a, cursor_index);
+        bool backspace = deletes > 0 && to_end <= to_start;
+        size_t target = backspace ? b : a;
+        size_t moves = backspace ? to_end : to_start;
+
+        if (target >= cursor_index) {
+            pushKeys(out, HID_USAGE_RIGHT_ARROW, moves);
+        } else {
+            pushKeys(out, HID_USAGE_LEFT_ARROW, moves);
+        }
+        if (composing && moves == 0 && deletes > 0) {
+            // 조합 중인 음절에 Backspace를 보내면 자모 하나만 지워지므로 먼저 조합을 확정
+            pushKeys(out, HID_USAGE_LEFT_ARROW, 1);
+            pushKeys(out, HID_USAGE_RIGHT_ARROW, 1);
+        }
+        pushKeys(out, backspace ? HID_USAGE_BACKSPACE : HID_USAGE_DELETE, deletes);
+
+        if (out.size() > before) {
+            // 커서를 옮기거나 지우면 IME 조합이 끊기므로 앞 음절과 이어지지 않음
+            context.previous_syllable = 0;
+            composing = false;
+        }
+        if (p < q) {
+            KeystrokeCompiler::compile(text + new_offsets[p], new_offsets[q] - new_offsets[p],
+                                       out, layout, false, &context);
+            composing = out.size() > before && out.back().role != JAMO_ROLE_NONE;
+        }
+    }
+
+    // 사본 갱신 - 입력할 수 없는 글자는 표시만 남김
+    chars.erase(chars.begin() + a, chars.begin() + b);
+    chars.insert(chars.begin() + a, new_chars.begin() + p, new_chars.begin() + q);
+    for (size_t k = a; k < a + (q - p); k++) {
+        if (!KeystrokeCompiler::isTypeable(chars[k], layout)) {
+            chars[k] |= SHADOW_ABSENT;
+        }
+    }
+    if (edited) {
+        // 커서를 범위로 옮겨 지우고 새 글자를 입력했으므로 호스트 커서는 새 글자 뒤
+        cursor_index = a + (q - p);
+    } else if (cursor_index >= b) {
+        // 키를 보내지 않음 (같은 글자 또는 입력되지 않은 글자만 바뀜) - 호스트 커서는 그대로
+        cursor_index -= b - a;
+    } else if (cursor_index > a) {
+        cursor_index = a;  // 지운 범위는 모두 입력되지 않은 글자라 호스트에서는 같은 위치
+    }
+
+    edit_stats.edits++;
+    edit_stats.keys += out.size() - before;
+    edit_stats.retype_keys += retype + presentBetween(start - origin, chars.size());
+    trimFront();
+    return true;
+}
+
+void ShadowText::trimFront() {
+    if (chars.size() <= SHADOW_MAX_CHARS) {
+        return;
+    }
+    // 한 번에 1/4을 잘라 잦은 이동을 피함 (커서 앞부분만)
+    size_t drop = SHADOW_MAX_CHARS / 4;
+    if (drop > cursor_index) {
+        drop = cursor_index;
+    }
+    chars.erase(chars.begin(), chars.begin() + drop);
+    origin += drop;
+    cursor_index -= drop;
+}
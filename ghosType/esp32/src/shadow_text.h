@@ -0,0 +1,96 @@
+/**
+ * @file shadow_text.h
+ * @brief 라이브 미러로 입력한 텍스트의 사본과 편집 → 최소 키 입력 변환
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 장치가 호스트에 입력한 텍스트의 사본(코드 포인트 열)과 호스트 커서 위치를 유지합니다.
+ * 클라이언트가 "이미 입력한 텍스트의 [start, end)를 s로 바꿔라"라는 편집을 보내면
+ * 바뀌지 않은 앞뒤 부분을 잘라낸 뒤 커서 이동(←/→), 지우기(Backspace 또는 Delete),
+ * 새 글자 입력으로 이루어진 가장 짧은 키 입력 열을 만듭니다.
+ *
+ * 위치는 클라이언트 텍스트의 코드 포인트 기준입니다. 호스트 배열로 입력할 수 없어
+ * 건너뛴 글자는 사본에 표시해 두고 커서 이동/지우기 수에서 뺍니다.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+/**
+ * @brief 편집 통계
+ */
+struct EditStats {
+    uint32_t edits;           ///< 처리한 편집 수
+    uint32_t keys;            ///< 편집으로 보낸 키 이벤트 수
+    uint32_t retype_keys;     ///< 같은 결과를 바뀐 위치부터 다시 입력했을 때의 키 수 (비교용)
+};
+
+/**
+ * @brief 입력한 텍스트 사본 클래스
+ *
+ * 라이브 미러 세션(BLE 태스크)에서만 사용합니다.
+ */
+class ShadowText {
+public:
+    ShadowText();
+
+    /**
+     * @brief 사본과 통계 비우기 (세션 시작)
+     */
+    void clear();
+
+    /**
+     * @brief 사본 끝 위치 (클라이언트 코드 포인트 기준)
+     */
+    uint32_t end() const { return origin + chars.size(); }
+
+    /**
+     * @brief 현재 커서 위치 (클라이언트 코드 포인트 기준)
+     */
+    uint32_t cursor() const { return origin + cursor_index; }
+
+    /**
+     * @brief [start, end)를 text로 바꾸는 키 이벤트 생성 및 사본 갱신
+     * @param start 바꿀 범위 시작
+     * @param end 바꿀 범위 끝 (start와 같으면 삽입)
+     * @param text 새 텍스트 (UTF-8)
+     * @param length 바이트 길이
+     * @param layout 호스트 키보드 배열
+     * @param[in,out] context 한영 모드/앞 음절 (커서를 옮기면 앞 음절은 끊김)
+     * @param[out] out 키 이벤트를 덧붙일 목록
+     * @return false 범위가 사본 밖 (이미 잘려 나간 앞부분 포함)
+     */
+    bool replace(uint32_t start, uint32_t end, const char* text, size_t length,
+                 uint8_t layout, CompileContext& context, std::vector<KeyEvent>& out);
+
+    const EditStats& stats() const { return edit_stats; }
+
+private:
+    /**
+     * @brief 사본 [from, to) 중 호스트에 실제로 입력된 글자 수
+     */
+    size_t presentBetween(size_t from, size_t to) const;
+
+    /**
+     * @brief 같은 키를 count번 추가
+     */
+    static void pushKeys(std::vector<KeyEvent>& out, uint8_t usage, size_t count);
+
+    /**
+     * @brief 사본이 SHADOW_MAX_CHARS를 넘으면 커서 앞의 오래된 부분을 잘라냄
+     */
+    void trimFront();
+
+    std::vector<uint32_t> chars;   ///< 코드 포인트 (SHADOW_ABSENT: 호스트에 입력되지 않음)
+    uint32_t origin;               ///< chars[0]의 클라이언트 위치
+    size_t cursor_index;           ///< 호스트 커서 위치 (chars 인덱스)
+    bool composing;                ///< 마지막 키가 한글 자모 (IME 조합이 열려 있을 수 있음)
+    std::vector<uint32_t> new_chars;   ///< 새 텍스트 코드 포인트 (버퍼 재사용)
+    std::vector<size_t> new_offsets;   ///< 새 텍스트 코드 포인트별 바이트 위치
+    EditStats edit_stats;
+};
@@ -0,0 +1,168 @@
+/**
+ * @file snippet_store.cpp
+ * @brief 스니펫 저장소 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "snippet_store.h"
+#include <Preferences.h>
+#include <SPIFFS.h>
+
+// 정적 멤버 변수 초기화
+bool SnippetStore::initialized = false;
+bool SnippetStore::spiffs_mounted = false;
+
+static Preferences snippetPrefs;
+
+bool SnippetStore::initialize() {
+    if (initialized) {
+        return true;
+    }
+
+    initialized = snippetPrefs.begin(SNIPPET_NVS_NAMESPACE, false);
+    return initialized;
+}
+
+bool SnippetStore::save(uint16_t id, const std::vector<KeyEvent>& events) {
+    if (!initialized || events.empty()) {
+        return false;
+    }
+
+    // 헤더 + 이벤트 배열을 하나의 블롭으로 구성
+    SnippetHeader header;
+    header.magic[0] = 'G';
+    header.magic[1] = 'S';
+    header.version = SNIPPET_FORMAT_VERSION;
+    header.param_count = KeystrokeCompiler::countParams(events);
+    header.event_count = events.size();
+
+    size_t payload_size = events.size() * sizeof(KeyEvent);
+    size_t blob_size = sizeof(header) + payload_size;
+    if (blob_size > SNIPPET_MAX_BYTES) {
+        return false;
+    }
+
+    std::vector<uint8_t> blob(blob_size);
+    memcpy(blob.data(), &header, sizeof(header));
+    memcpy(blob.data() + sizeof(header), events.data(), payload_size);
+
+    // 같은 번호의 이전 항목은 저장 위치와 관계없이 정리
+    remove(id);
+
+    if (blob_size <= SNIPPET_NVS_MAX_BYTES) {
+        char key[16];
+        nvsKey(id, key, sizeof(key));
+        return snippetPrefs.putBytes(key, blob.data(), blob_size) == blob_size;
+    }
+
+    if (!ensureSpiffs(true)) {
+        return false;
+    }
+    char path[32];
+    filePath(id, path, sizeof(path));
+    File file = SPIFFS.open(path, FILE_WRITE);
+    if (!file) {
+        return false;
+    }
+    size_t written = file.write(blob.data(), blob_size);
+    file.close();
+    return written == blob_size;
+}
+
+bool SnippetStore::load(uint16_t id, std::vector<KeyEvent>& events) {
+    if (!initialized) {
+        return false;
+    }
+
+    // NVS 먼저 확인
+    char key[16];
+    nvsKey(id, key, sizeof(key));
+    size_t size = snippetPrefs.isKey(key) ? snippetPrefs.getBytesLength(key) : 0;
+    if (size > 0) {
+        std::vector<uint8_t> blob(size);
+        if (snippetPrefs.getBytes(key, blob.data(), size) != size) {
+            return false;
+        }
+        return decode(blob.data(), size, events);
+    }
+
+    // 큰 항목은 SPIFFS에서 확인 (조회 중에는 포맷하지 않음)
+    if (!ensureSpiffs(false)) {
+        return false;
+    }
+    char path[32];
+    filePath(id, path, sizeof(path));
+    if (!SPIFFS.exists(path)) {
+        return false;
+    }
+    File file = SPIFFS.open(path, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    size = file.size();
+    std::vector<uint8_t> blob(size);
+    size_t read = file.read(blob.data(), size);
+    file.close();
+    return read == size && decode(blob.data(), size, events);
+}
+
+bool SnippetStore::remove(uint16_t id) {
+    if (!initialized) {
+        return false;
+    }
+
+    bool removed = false;
+    char key[16];
+    nvsKey(id, key, sizeof(key));
+    bool in_nvs = snippetPrefs.isKey(key);
+    if (in_nvs) {
+        removed = snippetPrefs.remove(key);
+    }
+
+    // 한 번호는 NVS와 SPIFFS 중 한 곳에만 저장되므로 NVS에 있었으면 마운트된 경우에만 확인
+    if ((!in_nvs || spiffs_mounted) && ensureSpiffs(false)) {
+        char path[32];
+        filePath(id, path, sizeof(path));
+        if (SPIFFS.exists(path)) {
+            removed = SPIFFS.remove(path) || removed;
+        }
+    }
+    return removed;
+}
+
+bool SnippetStore::ensureSpiffs(bool format_on_fail) {
+    if (!spiffs_mounted) {
+        // 첫 사용 시 마운트 - 포맷은 저장할 때만 (조회/삭제가 기존 파일을 지우면 안 됨)
+        spiffs_mounted = SPIFFS.begin(format_on_fail);
+    }
+    return spiffs_mounted;
+}
+
+bool SnippetStore::decode(const uint8_t* blob, size_t size, std::vector<KeyEvent>& events) {
+    if (size < sizeof(SnippetHeader)) {
+        return false;
+    }
+
+    SnippetHeader header;
+    memcpy(&header, blob, sizeof(header));
+    if (header.magic[0] != 'G' || header.magic[1] != 'S' ||
+        header.version != SNIPPET_FORMAT_VERSION) {
+        return false;  // 다른 형식으로 저장된 항목은 다시 등록해야 함
+    }
+    if (sizeof(header) + header.event_count * sizeof(KeyEvent) != size) {
+        return false;
+    }
+
+    events.resize(header.event_count);
+    memcpy(events.data(), blob + sizeof(header), header.event_count * sizeof(KeyEvent));
+    return true;
+}
+
+void SnippetStore::nvsKey(uint16_t id, char* key, size_t size) {
+    snprintf(key, size, "s%u", (unsigned)id);
+}
+
+void SnippetStore::filePath(uint16_t id, char* path, size_t size) {
+    snprintf(path, size, "/snip_%u.bin", (unsigned)id);
+}
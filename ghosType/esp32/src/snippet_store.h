@@ -0,0 +1,85 @@
+/**
+ * @file snippet_store.h
+ * @brief 자주 쓰는 텍스트(스니펫)를 컴파일된 키 이벤트 열로 저장하는 모듈
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 서명, SQL 템플릿 같은 반복 텍스트를 한 번만 전송해 컴파일한 뒤
+ * NVS(작은 항목) 또는 SPIFFS(큰 항목)에 저장합니다.
+ * 이후에는 몇 바이트짜리 바이너리 호출 프레임으로 번호만 보내면
+ * 수신·파싱·컴파일 없이 바로 재생합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+/**
+ * @brief 저장 형식 헤더 (이벤트 배열 앞에 기록)
+ */
+struct SnippetHeader {
+    uint8_t magic[2];         ///< 'G', 'S'
+    uint8_t version;          ///< SNIPPET_FORMAT_VERSION
+    uint8_t param_count;      ///< 매개변수 개수
+    uint32_t event_count;     ///< 이벤트 개수
+};
+
+/**
+ * @brief 스니펫 저장소 클래스
+ */
+class SnippetStore {
+public:
+    /**
+     * @brief 저장소 초기화
+     * @return true 성공, false 실패
+     *
+     * NVS 네임스페이스를 엽니다. SPIFFS는 큰 항목을 처음 다룰 때 마운트합니다.
+     */
+    static bool initialize();
+
+    /**
+     * @brief 스니펫 저장
+     * @param id 스니펫 번호
+     * @param events 컴파일된 이벤트 열
+     * @return true 성공, false 실패
+     *
+     * 저장 크기가 SNIPPET_NVS_MAX_BYTES 이하이면 NVS, 초과하면 SPIFFS에 기록합니다.
+     */
+    static bool save(uint16_t id, const std::vector<KeyEvent>& events);
+
+    /**
+     * @brief 스니펫 불러오기
+     * @param id 스니펫 번호
+     * @param[out] events 저장된 이벤트 열
+     * @return true 성공, false 없음 또는 형식 오류
+     */
+    static bool load(uint16_t id, std::vector<KeyEvent>& events);
+
+    /**
+     * @brief 스니펫 삭제
+     * @param id 스니펫 번호
+     * @return true 삭제됨, false 없음
+     */
+    static bool remove(uint16_t id);
+
+private:
+    static bool initialized;        ///< NVS 초기화 상태
+    static bool spiffs_mounted;     ///< SPIFFS 마운트 상태
+
+    /**
+     * @brief 필요 시 SPIFFS 마운트
+     * @param format_on_fail 마운트 실패 시 포맷 (쓰기 경로에서만 사용)
+     */
+    static bool ensureSpiffs(bool format_on_fail);
+
+    /**
+     * @brief 저장 형식 검증 후 이벤트 복원
+     */
+    static bool decode(const uint8_t* blob, size_t size, std::vector<KeyEvent>& events);
+
+    static void nvsKey(uint16_t id, char* key, size_t size);
+    static void filePath(uint16_t id, char* path, size_t size);
+};
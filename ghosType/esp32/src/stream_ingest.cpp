@@ -0,0 +1,430 @@
+/**
+ * @file stream_ingest.cpp
+ * @brief 긴 메시지를 다 받기 전에 타이핑을 시작하는 스트리밍 수신 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "stream_ingest.h"
+#include <string.h>
+
+// 키 이름/스칼라 값 최대 길이 (이보다 긴 값은 설정 키가 아니므로 잘라도 무방)
+static const size_t STREAM_VALUE_MAX = 32;
+
+static bool isJsonSpace(uint8_t c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static int hexValue(uint8_t c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+StreamIngest::StreamIngest()
+    : ring(NULL), capacity(0), head(0), tail(0), is_active(false), input_done(true),
+      has_overflowed(false), is_paused(false), finish_pending(false), state(SCAN_START), stream_layout(LAYOUT_US), unicode(0), unicode_digits(0),
+      high_surrogate(0), nested_depth(0), backlog_pos(0), context{ IME_MODE_UNKNOWN, 0 }, speed_cps(-1),
+      progress_ms(-1), started_at(0), first_key_seen(false) {
+    memset(&stream_stats, 0, sizeof(stream_stats));
+}
+
+void StreamIngest::initialize() {
+    // 용량은 2의 거듭제곱 (위치를 마스크로 계산)
+    capacity = STREAM_RING_EVENTS;
+#ifdef BOARD_HAS_PSRAM
+    if (psramFound()) {
+        capacity = STREAM_RING_EVENTS_PSRAM;
+        ring = (KeyEvent*)ps_malloc(capacity * sizeof(KeyEvent));
+    }
+#endif
+    if (!ring) {
+        capacity = STREAM_RING_EVENTS;
+        ring = (KeyEvent*)malloc(capacity * sizeof(KeyEvent));
+    }
+    if (!ring) {
+        capacity = 0;
+    }
+}
+
+bool StreamIngest::begin(uint8_t layout) {
+    if (is_active || capacity == 0) {
+        return false;
+    }
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    input_done = false;
+    has_overflowed = false;
+    is_paused = false;
+    finish_pending = false;
+    state = SCAN_START;
+    stream_layout = layout;
+    key = "";
+    value = "";
+    unicode = 0;
+    unicode_digits = 0;
+    high_surrogate = 0;
+    nested_depth = 0;
+    pending.clear();
+    backlog.clear();
+    backlog_pos = 0;
+    context.mode = IME_MODE_UNKNOWN;
+    context.previous_syllable = 0;
+    speed_cps = -1;
+    progress_ms = -1;
+    started_at = millis();
+    first_key_seen = false;
+
+    stream_stats.streams++;
+    stream_stats.bytes = 0;
+    stream_stats.events = 0;
+    stream_stats.first_key_ms = 0;
+    stream_stats.pauses = 0;
+    is_active = true;
+    return true;
+}
+
+bool StreamIngest::feed(const uint8_t* data, size_t length) {
+    if (!is_active || input_done || finish_pending) {
+        return false;
+    }
+    stream_stats.bytes += length;
+    for (size_t i = 0; i < length; i++) {
+        scan(data[i]);
+    }
+    return flushText(false);
+}
+
+bool StreamIngest::finish() {
+    if (!is_active || input_done || finish_pending) {
+        return false;
+    }
+    if (state == SCAN_SCALAR) {
+        finishValue();  // 닫는 괄호 없이 끝난 문서의 마지막 값
+    }
+    bool ok = flushText(true);
+    if (ok && backlog_pos < backlog.size()) {
+        finish_pending = true;  // 보관분을 다 넣으면 refill에서 끝냄
+    } else {
+        input_done = true;
+    }
+    return ok;
+}
+
+bool StreamIngest::refill() {
+    if (!is_active || !is_paused) {
+        return false;
+    }
+    pushBacklog();
+    if (backlog_pos < backlog.size() || buffered() > capacity / 2) {
+        return false;
+    }
+    if (finish_pending) {
+        finish_pending = false;
+        input_done = true;
+    }
+    // 정지는 여기서만 풂 (클라이언트가 알림을 받아야 다시 보내므로)
+    is_paused = false;
+    return !input_done;  // 끝 프레임을 이미 받았으면 더 보낼 것이 없으므로 알리지 않음
+}
+
+size_t StreamIngest::buffered() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+bool StreamIngest::next(KeyEvent& event) {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    event = ring[t & (capacity - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+bool StreamIngest::drained() const {
+    return input_done && tail.load(std::memory_order_relaxed) == head.load(std::memory_order_acquire);
+}
+
+void StreamIngest::end() {
+    input_done = true;
+    is_active = false;
+}
+
+void StreamIngest::firstKeyTyped() {
+    if (!first_key_seen) {
+        first_key_seen = true;
+        stream_stats.first_key_ms = millis() - started_at;
+    }
+}
+
+void StreamIngest::scan(uint8_t c) {
+    switch (state) {
+        case SCAN_RAW:
+            pending.push_back((char)c);
+            break;
+        case SCAN_START:
+            if (isJsonSpace(c)) {
+                break;
+            }
+            if (c == '{') {
+                state = SCAN_EXPECT_KEY;
+            } else {
+                // JSON이 아니면 일반 텍스트 작업과 같이 전부 입력
+                state = SCAN_RAW;
+                pending.push_back((char)c);
+            }
+            break;
+        case SCAN_EXPECT_KEY:
+            if (c == '"') {
+                key = "";
+                state = SCAN_KEY;
+            } else if (c == '}') {
+                state = SCAN_DONE;
+            }
+            break;  // 공백과 ',' 무시
+        case SCAN_KEY:
+            if (c == '"') {
+                state = SCAN_EXPECT_COLON;
+            } else if (key.length() < STREAM_VALUE_MAX) {
+                key += (char)c;
+            }
+            break;
+        case SCAN_EXPECT_COLON:
+            if (c == ':') {
+                state = SCAN_EXPECT_VALUE;
+            }
+            break;
+        case SCAN_EXPECT_VALUE:
+            if (isJsonSpace(c)) {
+                break;
+            }
+            value = "";
+            if (c == '"') {
+                state = key == JSON_FIELD_TEXT ? SCAN_TEXT : SCAN_STRING;
+            } else if (c == '{' || c == '[') {
+                nested_depth = 1;
+                state = SCAN_NESTED;
+            } else {
+                value += (char)c;
+                state = SCAN_SCALAR;
+            }
+            break;
+        case SCAN_TEXT:
+            if (c == '\\') {
+                state = SCAN_TEXT_ESCAPE;
+            } else if (c == '"') {
+                state = SCAN_EXPECT_KEY;
+            } else {
+                pending.push_back((char)c);
+            }
+            break;
+        case SCAN_TEXT_ESCAPE:
+            state = SCAN_TEXT;
+            switch (c) {
+                case 'n': pending.push_back('\n'); break;
+                case 't': pending.push_back('\t'); break;
+                case 'r': pending.push_back('\r'); break;
+                case 'b': pending.push_back('\b'); break;
+                case 'f': break;  // 입력할 키 없음
+                case 'u':
+                    unicode = 0;
+                    unicode_digits = 0;
+                    state = SCAN_TEXT_UNICODE;
+                    break;
+                default: pending.push_back((char)c); break;  // \" \\ \/
+            }
+            break;
+        case SCAN_TEXT_UNICODE: {
+            int digit = hexValue(c);
+            if (digit < 0) {
+                state = SCAN_TEXT;  // 잘못된 이스케이프는 버림
+                break;
+            }
+            unicode = (unicode << 4) | (uint32_t)digit;
+            if (++unicode_digits < 4) {
+                break;
+            }
+            state = SCAN_TEXT;
+            if (unicode >= 0xD800 && unicode <= 0xDBFF) {
+                high_surrogate = unicode;  // 짝이 되는 하위 대리 코드 대기
+            } else if (unicode >= 0xDC00 && unicode <= 0xDFFF) {
+                if (high_surrogate != 0) {
+                    appendCodePoint(0x10000 + ((high_surrogate - 0xD800) << 10) + (unicode - 0xDC00));
+                }
+                high_surrogate = 0;
+            } else {
+                appendCodePoint(unicode);
+                high_surrogate = 0;
+            }
+            break;
+        }
+        case SCAN_STRING:
+            if (c == '\\') {
+                state = SCAN_STRING_ESCAPE;
+            } else if (c == '"') {
+                finishValue();
+                state = SCAN_EXPECT_KEY;
+            } else if (value.length() < STREAM_VALUE_MAX) {
+                value += (char)c;
+            }
+            break;
+        case SCAN_STRING_ESCAPE:
+            if (value.length() < STREAM_VALUE_MAX) {
+                value += (char)c;
+            }
+            state = SCAN_STRING;
+            break;
+        case SCAN_SCALAR:
+            if (c == ',' || c == '}' || isJsonSpace(c)) {
+                finishValue();
+                state = c == '}' ? SCAN_DONE : SCAN_EXPECT_KEY;
+            } else if (value.length() < STREAM_VALUE_MAX) {
+                value += (char)c;
+            }
+            break;
+        case SCAN_NESTED:
+            if (c == '"') {
+                state = SCAN_NESTED_STRING;
+            } else if (c == '{' || c == '[') {
+                nested_depth++;
+            } else if ((c == '}' || c == ']') && --nested_depth == 0) {
+                state = SCAN_EXPECT_KEY;
+            }
+            break;
+        case SCAN_NESTED_STRING:
+            if (c == '\\') {
+                state = SCAN_NESTED_ESCAPE;
+            } else if (c == '"') {
+                state = SCAN_NESTED;
+            }
+            break;
+        case SCAN_NESTED_ESCAPE:
+            state = SCAN_NESTED_STRING;
+            break;
+        default:
+            break;  // 문서 끝 이후는 무시
+    }
+}
+
+void StreamIngest::finishValue() {
+    if (key == JSON_FIELD_SPEED) {
+        speed_cps = CLAMP((int)value.toInt(), MIN_TYPING_SPEED_CPS, MAX_TYPING_SPEED_CPS);
+    } else if (key == JSON_FIELD_PROGRESS) {
+        progress_ms = value.toInt();
+    } else if (key == JSON_FIELD_LAYOUT) {
+        // 이후 조각의 컴파일부터 적용
+        Keymap::fromName(value.c_str(), stream_layout);
+    }
+}
+
+void StreamIngest::appendCodePoint(uint32_t code_point) {
+    // \uXXXX를 UTF-8로 되돌려 일반 글자와 같은 경로로 컴파일
+    if (code_point < 0x80) {
+        pending.push_back((char)code_point);
+    } else if (code_point < 0x800) {
+        pending.push_back((char)(0xC0 | (code_point >> 6)));
+        pending.push_back((char)(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        pending.push_back((char)(0xE0 | (code_point >> 12)));
+        pending.push_back((char)(0x80 | ((code_point >> 6) & 0x3F)));
+        pending.push_back((char)(0x80 | (code_point & 0x3F)));
+    } else {
+        pending.push_back((char)(0xF0 | (code_point >> 18)));
+        pending.push_back((char)(0x80 | ((code_point >> 12) & 0x3F)));
+        pending.push_back((char)(0x80 | ((code_point >> 6) & 0x3F)));
+        pending.push_back((char)(0x80 | (code_point & 0x3F)));
+    }
+}
+
+bool StreamIngest::flushText(bool final) {
+    size_t cut = pending.size();
+    if (!final) {
+        // 다음 조각으로 이어지는 미완성 UTF-8 글자는 남겨 둠
+        for (size_t back = 1; back <= 3 && back <= cut; back++) {
+            uint8_t c = (uint8_t)pending[cut - back];
+            if ((c & 0xC0) == 0x80) {
+                continue;  // 연속 바이트
+            }
+            size_t need = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+            if (need > back) {
+                cut -= back;
+            }
+            break;
+        }
+        // 조각 경계에 걸친 토글 마커도 남겨 둠 (마커 앞부분과 같은 가장 긴 꼬리)
+        const size_t marker_length = strlen(TOGGLE_MARKER);
+        for (size_t k = cut > marker_length ? cut - marker_length + 1 : 0; k < cut; k++) {
+            if (memcmp(pending.data() + k, TOGGLE_MARKER, cut - k) == 0) {
+                cut = k;
+                break;
+            }
+        }
+    }
+    if (cut == 0) {
+        return true;
+    }
+
+    KeystrokeCompiler::compile(pending.data(), cut, backlog, stream_layout, false, &context);
+    pending.erase(pending.begin(), pending.begin() + cut);
+    pushBacklog();
+    if (backlog.size() - backlog_pos > STREAM_BACKLOG_EVENTS) {
+        // 일시 정지 뒤에도 클라이언트가 계속 보냄 - 스트림 중단
+        has_overflowed = true;
+        input_done = true;
+        backlog.clear();
+        backlog_pos = 0;
+        stream_stats.overflows++;
+        return false;
+    }
+    if (!is_paused && (backlog_pos < backlog.size() || capacity - buffered() < STREAM_PAUSE_FREE_EVENTS)) {
+        // 타이핑이 수신을 따라가지 못함 - 전송 중인 조각이 들어갈 자리를 남기고 정지
+        is_paused = true;
+        stream_stats.pauses++;
+    }
+    return true;
+}
+
+void StreamIngest::pushBacklog() {
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t space = capacity - (h - tail.load(std::memory_order_acquire));
+    size_t count = MIN(space, backlog.size() - backlog_pos);
+    for (size_t i = 0; i < count; i++) {
+        ring[(h + i) & (capacity - 1)] = backlog[backlog_pos + i];
+    }
+    head.store(h + count, std::memory_order_release);
+    backlog_pos += count;
+    stream_stats.events += count;
+    if (backlog_pos == backlog.size()) {
+        backlog.clear();
+        backlog_pos = 0;
+    }
+}
+
+String StreamIngest::statsJson() const {
+    String json = "{\"active\":";
+    json += is_active ? "true" : "false";
+    json += ",\"paused\":";
+    json += is_paused ? "true" : "false";
+    json += ",\"buffered\":";
+    json += (unsigned int)buffered();
+    json += ",\"capacity\":";
+    json += (unsigned int)capacity;
+    json += ",\"streams\":";
+    json += stream_stats.streams;
+    json += ",\"bytes\":";
+    json += stream_stats.bytes;
+    json += ",\"events\":";
+    json += stream_stats.events;
+    json += ",\"first_key_ms\":";
+    json += stream_stats.first_key_ms;
+    json += ",\"pauses\":";
+    json += stream_stats.pauses;
+    json += ",\"overflows\":";
+    json += stream_stats.overflows;
+    json += ",\"timeouts\":";
+    json += stream_stats.timeouts;
+    json += "}";
+    return json;
+}
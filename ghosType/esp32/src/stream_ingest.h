@@ -0,0 +1,210 @@
+/**
+ * @file stream_ingest.h
+ * @brief 긴 메시지를 다 받기 전에 타이핑을 시작하는 스트리밍 수신
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 일반 작업은 deserializeJson이 문서 전체를 필요로 하므로 여러 번의 쓰기로 나뉜
+ * 메시지가 모두 도착해야 타이핑을 시작합니다. 스트리밍 작업은 수신하는 즉시
+ * JSON의 "text" 값을 점진적으로 해석(이스케이프, \uXXXX 포함)하고 완성된 UTF-8
+ * 글자부터 키 이벤트로 컴파일해 링 버퍼에 넣습니다. 타이핑 루프는 나머지가
+ * 도착하는 동안 링 버퍼에서 꺼내 입력하므로 첫 키까지의 시간이 문서 크기와 무관합니다.
+ *
+ * 타이핑보다 수신이 빠르면 링 버퍼 빈자리가 STREAM_PAUSE_FREE_EVENTS 아래로 내려갈 때
+ * 일시 정지 상태가 되고(클라이언트에 STREAM:pause), 링 버퍼에 못 넣은 이벤트는 보관했다가
+ * 타이핑 루프가 절반까지 비우면 채워 넣고 정지를 풉니다(STREAM:resume).
+ * 클라이언트가 정지를 무시해 보관분이 STREAM_BACKLOG_EVENTS를 넘을 때만 스트림을 중단합니다.
+ *
+ * "text"보다 앞에 있는 speed_cps, progress_ms, layout은 적용되고 뒤에 있는 값은
+ * 무시됩니다. '{'로 시작하지 않는 스트림은 일반 텍스트로 처리합니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <vector>
+#include "config.h"
+#include "keystroke_compiler.h"
+
+/**
+ * @brief 스트리밍 수신 통계
+ */
+struct StreamStats {
+    uint32_t streams;         ///< 시작한 스트림 수
+    uint32_t bytes;           ///< 마지막 스트림의 수신 바이트
+    uint32_t events;          ///< 마지막 스트림의 컴파일된 키 이벤트 수
+    uint32_t first_key_ms;    ///< 마지막 스트림의 시작 프레임 → 첫 키 입력 시간
+    uint32_t pauses;          ///< 마지막 스트림의 일시 정지 수
+    uint32_t overflows;       ///< 일시 정지를 무시해 보관분이 넘쳐 중단된 스트림 수
+    uint32_t timeouts;        ///< 다음 데이터가 오지 않아 중단된 스트림 수
+};
+
+/**
+ * @brief 스트리밍 수신 클래스
+ *
+ * begin/feed/finish는 BLE 태스크(생산자), next/drained/end/firstKeyTyped는 타이핑 루프(소비자)에서
+ * 호출합니다. 링 버퍼는 생산자 하나, 소비자 하나의 잠금 없는 큐입니다.
+ * refill은 생산자 쪽 함수이므로 타이핑 루프는 수신 처리와 같은 잠금(ingestMutex)을 잡고 호출합니다.
+ */
+class StreamIngest {
+public:
+    StreamIngest();
+
+    /**
+     * @brief 링 버퍼 할당 (setup에서 한 번, PSRAM이 있으면 PSRAM에 더 크게)
+     */
+    void initialize();
+
+    /**
+     * @brief 스트림 시작
+     * @param layout 호스트 키보드 배열 (JSON의 layout이 앞에 있으면 그 값으로 바뀜)
+     * @return false 이미 진행 중인 스트림이 있음
+     */
+    bool begin(uint8_t layout);
+
+    /**
+     * @brief 수신한 조각 처리
+     * @param data 조각
+     * @param length 바이트 길이
+     * @return false 보관분이 넘쳐 스트림을 중단함 (일시 정지 중에 계속 보냄)
+     */
+    bool feed(const uint8_t* data, size_t length);
+
+    /**
+     * @brief 스트림 끝 (남은 글자 컴파일)
+     * @return false 진행 중인 스트림이 없거나 보관분이 넘침
+     *
+     * 보관분이 남아 있으면 모두 링 버퍼에 넣은 뒤에 끝난 것으로 봅니다 (drained).
+     */
+    bool finish();
+
+    bool active() const { return is_active; }
+
+    /**
+     * @brief 현재/마지막 스트림의 받은 바이트 (세션 재개 시 연속 프레임을 이어 보낼 위치)
+     */
+    uint32_t receivedBytes() const { return stream_stats.bytes; }
+
+    /**
+     * @brief 보관분이 넘쳐 스트림이 중단되었는지 확인
+     */
+    bool overflowed() const { return has_overflowed; }
+
+    /**
+     * @brief 일시 정지 중인지 확인 (클라이언트는 STREAM:resume까지 보내지 않아야 함)
+     */
+    bool paused() const { return is_paused; }
+
+    /**
+     * @brief 링 버퍼에 들어 있는 이벤트 수
+     */
+    size_t buffered() const;
+
+    /**
+     * @brief 일시 정지를 풀 수 있을 만큼 링 버퍼가 비었는지 확인 (타이핑 루프, 잠금 없이)
+     */
+    bool refillDue() const { return is_paused && buffered() <= capacity / 2; }
+
+    /**
+     * @brief 보관분을 링 버퍼에 채우고 일시 정지 해제 (생산자 쪽 - ingestMutex를 잡고 호출)
+     * @return true 정지가 풀려 클라이언트에 STREAM:resume을 보내야 함
+     */
+    bool refill();
+
+    /**
+     * @brief 다음 키 이벤트 꺼내기 (기다리지 않음)
+     * @param[out] event 꺼낸 이벤트
+     * @return true 꺼냄
+     */
+    bool next(KeyEvent& event);
+
+    /**
+     * @brief 스트림이 끝났고 남은 이벤트도 없는지 확인
+     */
+    bool drained() const;
+
+    /**
+     * @brief 타이핑 루프의 스트림 종료 (다 입력했거나 시간 초과), 이후 수신 조각은 거부
+     */
+    void end();
+
+    /**
+     * @brief 첫 키 입력 기록 (첫 키까지의 시간 측정)
+     */
+    void firstKeyTyped();
+
+    /**
+     * @brief 스트림 앞부분에서 읽은 설정 (-1: 없음)
+     */
+    int speedCps() const { return speed_cps; }
+    int32_t progressMs() const { return progress_ms; }
+    uint8_t layout() const { return stream_layout; }
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"active":b,"paused":b,"buffered":n,"capacity":n,"streams":n,"bytes":n,"events":n,
+     *          "first_key_ms":n,"pauses":n,"overflows":n,"timeouts":n}
+     */
+    String statsJson() const;
+
+    /**
+     * @brief 스트림 중단 기록 (타이핑 루프에서 다음 데이터 대기 시간 초과)
+     */
+    void recordTimeout() { stream_stats.timeouts++; }
+
+private:
+    // JSON 최상위 객체 해석 상태
+    enum ScanState {
+        SCAN_RAW,             ///< 일반 텍스트 스트림 - 모두 텍스트
+        SCAN_START,           ///< 첫 글자 대기 ('{'이면 JSON)
+        SCAN_EXPECT_KEY,
+        SCAN_KEY,
+        SCAN_EXPECT_COLON,
+        SCAN_EXPECT_VALUE,
+        SCAN_TEXT,            ///< "text" 문자열 값
+        SCAN_TEXT_ESCAPE,
+        SCAN_TEXT_UNICODE,
+        SCAN_STRING,          ///< 다른 키의 문자열 값
+        SCAN_STRING_ESCAPE,
+        SCAN_SCALAR,          ///< 숫자/true/false/null
+        SCAN_NESTED,          ///< 중첩 객체/배열 (건너뜀)
+        SCAN_NESTED_STRING,
+        SCAN_NESTED_ESCAPE,
+        SCAN_DONE
+    };
+
+    void scan(uint8_t c);
+    void finishValue();
+    void appendCodePoint(uint32_t code_point);
+    bool flushText(bool final);
+    void pushBacklog();
+
+    KeyEvent* ring;
+    size_t capacity;
+    std::atomic<size_t> head;   ///< 생산자 쓰기 위치
+    std::atomic<size_t> tail;   ///< 소비자 읽기 위치
+    volatile bool is_active;
+    volatile bool input_done;   ///< 끝 프레임 수신 (또는 중단)
+    volatile bool has_overflowed;
+    volatile bool is_paused;
+    bool finish_pending;        ///< 끝 프레임을 받았지만 보관분이 남음
+
+    uint8_t state;
+    uint8_t stream_layout;
+    String key;                 ///< 현재 키 이름
+    String value;               ///< 현재 스칼라/문자열 값
+    uint32_t unicode;           ///< \uXXXX 누적
+    uint8_t unicode_digits;
+    uint32_t high_surrogate;    ///< 짝을 기다리는 상위 대리 코드
+    uint8_t nested_depth;
+    std::vector<char> pending;  ///< 아직 컴파일하지 않은 텍스트 (미완성 UTF-8/토글 마커 포함)
+    std::vector<KeyEvent> backlog;  ///< 컴파일했지만 링 버퍼에 아직 넣지 못한 이벤트
+    size_t backlog_pos;             ///< backlog에서 다음에 넣을 위치
+    CompileContext context;
+    int speed_cps;
+    int32_t progress_ms;
+    uint32_t started_at;
+    bool first_key_seen;
+    StreamStats stream_stats;
+};
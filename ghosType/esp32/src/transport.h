@@ -0,0 +1,114 @@
+/**
+ * @file transport.h
+ * @brief 메시지 수신 경로 인터페이스
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * BLE, USB CDC, 호스트 빌드의 유닉스 도메인 소켓이 같은 인터페이스로 메시지를 받고
+ * 응답을 보냅니다. 메시지 하나는 BLE 쓰기 하나와 같은 단위이며, 경로마다 필요한
+ * 프레이밍(CDC 길이 헤더 등)은 구현 안에서 처리합니다.
+ *
+ * 각 구현은 begin()에서 자신의 수신 태스크나 콜백을 준비하고, 메시지가 완성될 때마다
+ * 수신 처리 함수를 호출합니다. 수신 처리 함수는 여러 경로의 태스크에서 동시에 불릴 수 있습니다.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "transport_counter.h"
+#include "frame_sequencer.h"
+
+class ITransport;
+class LinkManager;
+
+/**
+ * @brief 완성된 메시지 처리 함수
+ */
+typedef void (*TransportReceiveHandler)(ITransport& from, const uint8_t* data, size_t length);
+
+/**
+ * @brief 연결/해제 알림 함수
+ */
+typedef void (*TransportConnectionHandler)(ITransport& from, bool connected);
+
+/**
+ * @brief 메시지 수신 경로 인터페이스
+ */
+class ITransport {
+public:
+    ITransport() : receive_handler(NULL), connection_handler(NULL) {}
+    virtual ~ITransport() {}
+
+    /**
+     * @brief 경로 이름 (상태 보고용, 예: "ble", "cdc", "sock")
+     */
+    virtual const char* name() const = 0;
+
+    /**
+     * @brief 수신 시작 (setup에서 한 번)
+     * @param on_receive 메시지 처리 함수
+     * @param on_connection 연결/해제 알림 함수 (NULL 가능)
+     * @return true 성공
+     */
+    virtual bool begin(TransportReceiveHandler on_receive, TransportConnectionHandler on_connection) = 0;
+
+    /**
+     * @brief 응답 전송 (연결되어 있지 않으면 버림)
+     * @param message 응답 문자열
+     */
+    virtual void notify(const String& message) = 0;
+
+    /**
+     * @brief 상대가 연결되어 있는지 확인
+     */
+    virtual bool connected() const = 0;
+
+    /**
+     * @brief 쓰기 한 번에 보낼 수 있는 최대 바이트 (BLE는 MTU - 3, 스트림 경로는 메시지 최대 크기)
+     */
+    virtual size_t mtu() const = 0;
+
+    const TransportCounter& counter() const { return rx_counter; }
+
+    /**
+     * @brief 순번 프레임 수신 창 (이 경로의 수신 태스크/콜백에서만 사용)
+     */
+    FrameSequencer& sequencer() { return rx_sequencer; }
+    const FrameSequencer& sequencer() const { return rx_sequencer; }
+
+    /**
+     * @brief 연결 파라미터를 조절하는 경로의 링크 관리 (BLE와 호스트 빌드의 소켓, 나머지는 NULL)
+     */
+    virtual const LinkManager* link() const { return NULL; }
+
+protected:
+    /**
+     * @brief 완성된 메시지 전달 (구현의 수신 태스크/콜백에서 호출)
+     */
+    void deliver(const uint8_t* data, size_t length) {
+        if (length == 0 || length > MAX_MESSAGE_BYTES) {
+            rx_counter.reject();
+            return;
+        }
+        rx_counter.record(length, millis());
+        if (receive_handler) {
+            receive_handler(*this, data, length);
+        }
+    }
+
+    /**
+     * @brief 연결 상태 변경 알림
+     */
+    void connectionChanged(bool connected) {
+        rx_sequencer.reset();  // 순번은 연결마다 0부터, 끊기면 보관한 메시지 버림
+        if (connection_handler) {
+            connection_handler(*this, connected);
+        }
+    }
+
+    TransportReceiveHandler receive_handler;
+    TransportConnectionHandler connection_handler;
+    TransportCounter rx_counter;
+    FrameSequencer rx_sequencer;
+};
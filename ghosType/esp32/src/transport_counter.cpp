@@ -0,0 +1,45 @@
+/**
+ * @file transport_counter.cpp
+ * @brief 수신 경로별 처리량 통계 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "transport_counter.h"
+
+TransportCounter::TransportCounter()
+    : messages(0), bytes_total(0), rejected(0), window_start(0), window_bytes(0),
+      last_bps(0), peak_bps(0) {
+}
+
+void TransportCounter::record(size_t bytes, uint32_t now_ms) {
+    messages++;
+    bytes_total += bytes;
+
+    uint32_t elapsed = now_ms - window_start;
+    if (elapsed >= TRANSPORT_RATE_WINDOW_MS) {
+        // 구간이 끝남 - 쉬었던 구간이 길면 처리량이 낮게 잡히므로 두 구간 이상 지났으면 새로 시작
+        last_bps = elapsed < 2 * TRANSPORT_RATE_WINDOW_MS ?
+            (uint32_t)((uint64_t)window_bytes * 1000 / elapsed) : 0;
+        peak_bps = MAX(peak_bps, last_bps);
+        window_start = now_ms;
+        window_bytes = 0;
+    }
+    window_bytes += bytes;
+}
+
+String TransportCounter::statsJson() const {
+    bool idle = millis() - window_start >= 2 * TRANSPORT_RATE_WINDOW_MS;
+    String json = "{\"msgs\":";
+    json += messages;
+    json += ",\"bytes\":";
+    json += bytes_total;
+    json += ",\"bps\":";
+    json += idle ? 0 : last_bps;
+    json += ",\"peak_bps\":";
+    json += peak_bps;
+    json += ",\"rejected\":";
+    json += rejected;
+    json += "}";
+    return json;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file transport_counter.h
+ * @brief 수신 경로(BLE, USB CDC)별 처리량 통계
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+/**
+ * @brief 수신 경로 하나의 메시지/바이트 수와 초당 처리량
+ *
+ * 처리량은 TRANSPORT_RATE_WINDOW_MS 구간마다 계산하고, 구간 두 개 동안 수신이 없으면 0으로 봅니다.
+ */
+class TransportCounter {
+public:
+    TransportCounter();
+
+    /**
+     * @brief 메시지 하나 수신 기록
+     * @param bytes 메시지 크기
+     * @param now_ms 현재 시각
+     */
+    void record(size_t bytes, uint32_t now_ms);
+
+    /**
+     * @brief 잘못된 프레임/너무 긴 메시지로 버린 수신 기록
+     */
+    void reject() { rejected++; }
+
+    /**
+     * @brief 통계를 JSON 문자열로 반환 (상태 보고용)
+     * @return {"msgs":n,"bytes":n,"bps":n,"peak_bps":n,"rejected":n}
+     */
+    String statsJson() const;
+
+private:
+    uint32_t messages;
+    uint32_t bytes_total;
+    uint32_t rejected;
+    uint32_t window_start;   ///< 현재 구간 시작 시각
+    uint32_t window_bytes;   ///< 현재 구간 수신 바이트
+    uint32_t last_bps;       ///< 직전 구간 처리량
+    uint32_t peak_bps;       ///< 최대 구간 처리량
+};
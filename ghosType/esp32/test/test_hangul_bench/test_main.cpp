@@ -0,0 +1,84 @@
+/**
+ * @file test_main.cpp
+ * @brief 한글 키 입력 컴파일 처리량 벤치마크 (pio test -e native -f test_hangul_bench)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * corpus.txt(한글/영문/숫자가 섞인 문장, 겹모음·겹받침 포함)를 두벌식 배열로 반복 컴파일해
+ * UTF-8 처리량을 재고, BENCH_MIN_MBPS보다 느리면 실패합니다.
+ * 하한은 최적화 없는 빌드와 느린 CI 기계에서도 통과하도록 잡은 값이라 회귀(예: 음절마다 표를
+ * 다시 만들거나 할당이 생기는 변경)만 잡습니다. 측정값은 테스트 출력에 남습니다.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "keystroke_compiler.h"
+
+#define BENCH_TOTAL_BYTES (4u * 1024 * 1024)  // 코퍼스를 반복해 이만큼 컴파일
+#define BENCH_MIN_MBPS 5                      // 처리량 하한 (MB/s)
+
+// 이 파일 옆의 데이터 파일 경로
+static std::string testFile(const char* name) {
+    std::string path(__FILE__);
+    size_t slash = path.rfind('/');
+    return (slash == std::string::npos ? std::string() : path.substr(0, slash + 1)) + name;
+}
+
+static std::string corpus;
+
+void setUp() {}
+void tearDown() {}
+
+// 코퍼스의 모든 문자가 두벌식 배열로 입력 가능 (건너뛰는 문자가 있으면 처리량이 부풀려짐)
+void test_corpus_typeable() {
+    size_t i = 0;
+    size_t syllables = 0;
+    while (i < corpus.size()) {
+        uint32_t code_point = KeystrokeCompiler::decodeUtf8(corpus.c_str(), corpus.size(), i);
+        TEST_ASSERT_TRUE_MESSAGE(KeystrokeCompiler::isTypeable(code_point, LAYOUT_KO_2SET), "untypeable character in corpus");
+        syllables += Hangul::isSyllable(code_point) ? 1 : 0;
+    }
+    TEST_ASSERT_GREATER_THAN(500, syllables);
+}
+
+void test_compile_throughput() {
+    std::vector<KeyEvent> events;
+    events.reserve(corpus.size() * 2);
+    size_t rounds = BENCH_TOTAL_BYTES / corpus.size() + 1;
+    size_t keys = 0;
+
+    uint32_t started = micros();
+    for (size_t round = 0; round < rounds; round++) {
+        events.clear();
+        keys += KeystrokeCompiler::compile(corpus.c_str(), corpus.size(), events, LAYOUT_KO_2SET);
+    }
+    uint32_t elapsed_us = micros() - started;
+
+    double megabytes = (double)rounds * corpus.size() / (1024 * 1024);
+    double mbps = megabytes * 1000000.0 / (elapsed_us ? elapsed_us : 1);
+    char message[96];
+    snprintf(message, sizeof(message), "%.1f MB in %lu us: %.1f MB/s, %.2f keys/byte",
+             megabytes, (unsigned long)elapsed_us, mbps, (double)keys / (rounds * corpus.size()));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE(BENCH_MIN_MBPS, mbps, message);
+}
+
+int main(int argc, char** argv) {
+    std::ifstream file(testFile("corpus.txt"));
+    std::stringstream text;
+    text << file.rdbuf();
+    corpus = text.str();
+
+    UNITY_BEGIN();
+    if (corpus.empty()) {
+        TEST_MESSAGE("corpus.txt not found");
+        return 1;
+    }
+    RUN_TEST(test_corpus_typeable);
+    RUN_TEST(test_compile_throughput);
+    return UNITY_END();
+}
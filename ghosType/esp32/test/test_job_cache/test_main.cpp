@@ -0,0 +1,85 @@
+/**
+ * @file test_main.cpp
+ * @brief 작업 캐시 조회 키와 저장 설정 테스트 (pio test -e native -f test_job_cache)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 조회 프레임에는 텍스트 해시와 길이만 있고 배열은 보낸 클라이언트의 CFG 배열로 찾으므로,
+ * 작업 JSON이 다른 배열을 지정한 작업도 클라이언트 배열로 적중하고
+ * 재생할 때 원래 작업의 배열/속도/진행 알림 주기를 돌려받는지 확인합니다.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "job_cache.h"
+#include "keymap.h"
+
+static const std::string TEXT(300, 'z');
+
+static uint32_t textHash() {
+    return JobCache::hashText(TEXT.c_str(), TEXT.size());
+}
+
+static std::vector<KeyEvent> compiled(uint8_t layout) {
+    std::vector<KeyEvent> events;
+    KeystrokeCompiler::compile(TEXT.c_str(), TEXT.size(), events, layout);
+    return events;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// {"layout":"de","speed_cps":80,"progress_ms":250}로 보낸 작업 - 클라이언트 CFG 배열은 us
+void test_job_layout_hits_under_client_layout() {
+    JobCache cache;
+    CachedJobSettings stored = { LAYOUT_DE, 80, 250 };
+    cache.store(textHash(), TEXT.size(), LAYOUT_US, stored, 400, compiled(LAYOUT_DE));
+
+    TEST_ASSERT_TRUE(cache.probe(textHash(), TEXT.size(), LAYOUT_US));
+    TEST_ASSERT_FALSE(cache.probe(textHash(), TEXT.size(), LAYOUT_DE));
+
+    std::vector<KeyEvent> events;
+    CachedJobSettings settings = { LAYOUT_US, -1, -1 };
+    TEST_ASSERT_TRUE(cache.fetch(textHash(), TEXT.size(), LAYOUT_US, events, settings));
+    TEST_ASSERT_EQUAL_UINT8(LAYOUT_DE, settings.layout);
+    TEST_ASSERT_EQUAL_INT(80, settings.speed_cps);
+    TEST_ASSERT_EQUAL_INT32(250, settings.progress_ms);
+    TEST_ASSERT_EQUAL(compiled(LAYOUT_DE).size(), events.size());
+    TEST_ASSERT_EQUAL_HEX8(compiled(LAYOUT_DE)[0].code, events[0].code);  // de의 z 키 (us의 y 자리)
+    TEST_ASSERT_EQUAL_UINT32(400, cache.stats().bytes_saved);
+}
+
+// 같은 텍스트를 다른 설정으로 다시 보내면 새 결과로 바뀜
+void test_store_replaces_different_settings() {
+    JobCache cache;
+    CachedJobSettings first = { LAYOUT_DE, 80, -1 };
+    CachedJobSettings second = { LAYOUT_US, -1, -1 };
+    cache.store(textHash(), TEXT.size(), LAYOUT_US, first, 400, compiled(LAYOUT_DE));
+    cache.store(textHash(), TEXT.size(), LAYOUT_US, second, 310, compiled(LAYOUT_US));
+
+    std::vector<KeyEvent> events;
+    CachedJobSettings settings;
+    TEST_ASSERT_TRUE(cache.fetch(textHash(), TEXT.size(), LAYOUT_US, events, settings));
+    TEST_ASSERT_EQUAL_UINT8(LAYOUT_US, settings.layout);
+    TEST_ASSERT_EQUAL_INT(-1, settings.speed_cps);
+    TEST_ASSERT_EQUAL_HEX8(compiled(LAYOUT_US)[0].code, events[0].code);
+}
+
+// 조회 적중만으로는 절약량을 세지 않음 (재생 전에 밀려날 수 있음)
+void test_probe_hit_does_not_count_saved_bytes() {
+    JobCache cache;
+    CachedJobSettings stored = { LAYOUT_US, -1, -1 };
+    cache.store(textHash(), TEXT.size(), LAYOUT_US, stored, 400, compiled(LAYOUT_US));
+    TEST_ASSERT_TRUE(cache.probe(textHash(), TEXT.size(), LAYOUT_US));
+    TEST_ASSERT_EQUAL_UINT32(0, cache.stats().bytes_saved);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_job_layout_hits_under_client_layout);
+    RUN_TEST(test_store_replaces_different_settings);
+    RUN_TEST(test_probe_hit_does_not_count_saved_bytes);
+    return UNITY_END();
+}
@@ -0,0 +1,82 @@
+/**
+ * @file test_main.cpp
+ * @brief 진행률 글자 수 테스트 (pio test -e native -f test_job_progress)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * PRG/STS의 typed/total이 키 이벤트 수가 아니라 원문 글자 수인지 확인합니다.
+ * 두벌식 한글 음절은 키 2~4개, 자동 한영 전환은 글자가 아니므로 이벤트 수와 달라집니다.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include "job_progress.h"
+#include "host_sync.h"
+
+static const char* TEXT = "\xED\x95\x9C\xEA\xB8\x80 ab\n";  // "한글 ab\n" - 6글자
+
+static std::vector<KeyEvent> compiled() {
+    std::vector<KeyEvent> events;
+    KeystrokeCompiler::compile(TEXT, strlen(TEXT), events, LAYOUT_KO_2SET);
+    return events;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_counts_source_characters() {
+    std::vector<KeyEvent> events = compiled();
+    TEST_ASSERT_TRUE(events.size() > 6);
+
+    JobProgress progress;
+    progress.begin(events.data(), events.size(), 0);
+    TEST_ASSERT_EQUAL(6, progress.totalChars());
+
+    // "한"의 키 3개 (앞의 조건부 전환 포함) 중 마지막 키에서 한 글자
+    size_t typed_at_first_char = 0;
+    for (size_t i = 0; i < events.size(); i++) {
+        progress.advance(events[i], i + 1 < events.size() ? &events[i + 1] : NULL);
+        if (progress.typedChars() == 1 && typed_at_first_char == 0) {
+            typed_at_first_char = i + 1;
+        }
+    }
+    TEST_ASSERT_EQUAL(4, typed_at_first_char);  // 전환 + ㅎ ㅏ ㄴ
+    TEST_ASSERT_EQUAL(6, progress.typedChars());
+    TEST_ASSERT_EQUAL(100, progress.percent());
+}
+
+// 스트림 작업 - 받은 이벤트를 하나씩 추가해도 같은 글자 수
+void test_stream_extend_counts_characters() {
+    std::vector<KeyEvent> events = compiled();
+    JobProgress progress;
+    progress.begin(NULL, 0, 0);
+    for (const KeyEvent& event : events) {
+        progress.extend(event);
+    }
+    TEST_ASSERT_EQUAL(6, progress.totalChars());
+    TEST_ASSERT_EQUAL(0, progress.typedChars());
+
+    progress.advance(events[0], &events[1]);
+    TEST_ASSERT_EQUAL(0, progress.typedChars());  // 전환은 글자가 아님
+}
+
+// HID 리포트에는 글자 끝 표시가 들어가지 않음
+void test_char_end_flag_not_reported() {
+    std::vector<KeyEvent> events;
+    KeystrokeCompiler::compile("A", 1, events, LAYOUT_US);
+    TEST_ASSERT_EQUAL(1, events.size());
+    TEST_ASSERT_TRUE(events[0].modifiers & KEY_CHAR_END);
+
+    HostSync sync;
+    TEST_ASSERT_EQUAL_HEX8(HID_MOD_LEFT_SHIFT, sync.modifiersFor(events[0]));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counts_source_characters);
+    RUN_TEST(test_stream_extend_counts_characters);
+    RUN_TEST(test_char_end_flag_not_reported);
+    return UNITY_END();
+}
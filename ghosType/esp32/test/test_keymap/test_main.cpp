@@ -0,0 +1,243 @@
+/**
+ * @file test_main.cpp
+ * @brief 키보드 배열 표 왕복 테스트 (pio test -e native -f test_keymap)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * keymap.h의 표는 물리 키 순서의 배열 문자열에서 만들어지므로, 여기서는 호스트 OS 쪽 배열을
+ * 자판의 줄(숫자 줄, 윗줄, 가운데 줄, 아랫줄) 단위로 따로 적어 두고 그 배열로 되읽어 봅니다.
+ * - 표 → 호스트: 표가 정한 키 조합을 호스트 배열로 읽으면 원래 문자
+ * - 호스트 → 표: 호스트 배열로 입력할 수 있는 문자(U+00FF 이하)는 모두 표에 있음
+ * - 컴파일러가 만든 키 이벤트 열을 되읽으면 원래 텍스트 (us/ko/de/dvorak)
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "keymap.h"
+#include "keystroke_compiler.h"
+
+// 키 하나를 호스트 배열로 읽은 문자
+struct HostKey {
+    char32_t base;
+    char32_t shift;
+    char32_t altgr;
+};
+
+// 자판 한 줄 - 물리 키 HID 사용 코드와 그 줄의 기본/Shift/AltGr 문자 (\0: 문자 없음 또는 데드 키)
+struct HostRow {
+    std::vector<uint8_t> usages;
+    std::u32string base;
+    std::u32string shift;
+    std::u32string altgr;
+};
+
+// 줄 위치는 배열과 무관 (ISO 키 0x32, 0x64 포함)
+static const std::vector<uint8_t> NUMBER_ROW = { 0x35, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x2D, 0x2E };
+static const std::vector<uint8_t> TOP_ROW = { 0x14, 0x1A, 0x08, 0x15, 0x17, 0x1C, 0x18, 0x0C, 0x12, 0x13, 0x2F, 0x30, 0x31 };
+static const std::vector<uint8_t> HOME_ROW = { 0x04, 0x16, 0x07, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x33, 0x34, 0x32 };
+static const std::vector<uint8_t> BOTTOM_ROW = { 0x64, 0x1D, 0x1B, 0x06, 0x19, 0x05, 0x11, 0x10, 0x36, 0x37, 0x38 };
+
+static std::u32string row(const char32_t* text, size_t length) {
+    return std::u32string(text, length);
+}
+#define ROW(s) row(s, sizeof(s) / sizeof(char32_t) - 1)
+
+static std::vector<HostRow> hostRows(uint8_t layout) {
+    switch (layout) {
+        case LAYOUT_US:
+        case LAYOUT_KO_2SET:
+            return {
+                { NUMBER_ROW, ROW(U"`1234567890-="), ROW(U"~!@#$%^&*()_+"), U"" },
+                { TOP_ROW, ROW(U"qwertyuiop[]\\"), ROW(U"QWERTYUIOP{}|"), U"" },
+                { HOME_ROW, ROW(U"asdfghjkl;'\0"), ROW(U"ASDFGHJKL:\"\0"), U"" },
+                { BOTTOM_ROW, ROW(U"\0zxcvbnm,./"), ROW(U"\0ZXCVBNM<>?"), U"" },
+            };
+        case LAYOUT_DE:
+            // ^ ´ `는 데드 키, €는 U+00FF 밖
+            return {
+                { NUMBER_ROW, ROW(U"\0001234567890ß\0"), ROW(U"°!\"§$%&/()=?\0"), ROW(U"\0\0²³\0\0\0{[]}\\\0") },
+                { TOP_ROW, ROW(U"qwertzuiopü+\0"), ROW(U"QWERTZUIOPÜ*\0"), ROW(U"@\0\0\0\0\0\0\0\0\0\0~\0") },
+                { HOME_ROW, ROW(U"asdfghjklöä#"), ROW(U"ASDFGHJKLÖÄ'"), ROW(U"\0\0\0\0\0\0\0\0\0\0\0\0") },
+                { BOTTOM_ROW, ROW(U"<yxcvbnm,.-"), ROW(U">YXCVBNM;:_"), ROW(U"|\0\0\0\0\0\0µ\0\0\0") },
+            };
+        case LAYOUT_DVORAK:
+            return {
+                { NUMBER_ROW, ROW(U"`1234567890[]"), ROW(U"~!@#$%^&*(){}"), U"" },
+                { TOP_ROW, ROW(U"',.pyfgcrl/=\\"), ROW(U"\"<>PYFGCRL?+|"), U"" },
+                { HOME_ROW, ROW(U"aoeuidhtns-\0"), ROW(U"AOEUIDHTNS_\0"), U"" },
+                { BOTTOM_ROW, ROW(U"\0;qjkxbmwvz"), ROW(U"\0:QJKXBMWVZ"), U"" },
+            };
+        default:
+            return {};
+    }
+}
+
+// 호스트 배열: 물리 키 → 문자
+static std::map<uint8_t, HostKey> hostLayout(uint8_t layout) {
+    std::map<uint8_t, HostKey> keys;
+    for (const HostRow& r : hostRows(layout)) {
+        TEST_ASSERT_EQUAL_MESSAGE(r.usages.size(), r.base.size(), "base row length");
+        TEST_ASSERT_EQUAL_MESSAGE(r.usages.size(), r.shift.size(), "shift row length");
+        for (size_t i = 0; i < r.usages.size(); i++) {
+            char32_t altgr = i < r.altgr.size() ? r.altgr[i] : 0;
+            keys[r.usages[i]] = { r.base[i], r.shift[i], altgr };
+        }
+    }
+    keys[0x2C] = { U' ', 0, 0 };
+    keys[0x28] = { U'\n', 0, 0 };
+    keys[0x2A] = { U'\b', 0, 0 };
+    keys[0x2B] = { U'\t', 0, 0 };
+    return keys;
+}
+
+// 키 조합 하나를 호스트 배열로 읽기 (0: 문자 없음)
+static char32_t hostType(const std::map<uint8_t, HostKey>& keys, uint8_t usage, uint8_t modifiers) {
+    auto it = keys.find(usage);
+    if (it == keys.end()) {
+        return 0;
+    }
+    switch (modifiers) {
+        case 0:                  return it->second.base;
+        case HID_MOD_LEFT_SHIFT: return it->second.shift;
+        case HID_MOD_RIGHT_ALT:  return it->second.altgr;
+        default:                 return 0;
+    }
+}
+
+static void checkTableRoundTrip(uint8_t layout) {
+    std::map<uint8_t, HostKey> keys = hostLayout(layout);
+    char message[64];
+
+    // 표 → 호스트
+    for (uint32_t c = 0; c < KEYMAP_DIRECT_RANGE; c++) {
+        KeyStroke stroke = Keymap::lookup(layout, c);
+        if (stroke.usage == 0) {
+            continue;
+        }
+        snprintf(message, sizeof(message), "%s U+%04X", Keymap::name(layout), (unsigned)c);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(c, hostType(keys, stroke.usage, stroke.modifiers), message);
+    }
+
+    // 호스트 → 표
+    for (const auto& entry : keys) {
+        for (char32_t c : { entry.second.base, entry.second.shift, entry.second.altgr }) {
+            if (c == 0 || c >= KEYMAP_DIRECT_RANGE) {
+                continue;
+            }
+            snprintf(message, sizeof(message), "%s U+%04X unmapped", Keymap::name(layout), (unsigned)c);
+            TEST_ASSERT_TRUE_MESSAGE(Keymap::lookup(layout, c).usage != 0, message);
+        }
+    }
+}
+
+// 컴파일한 키 이벤트 열을 호스트 배열로 되읽기 (한영 전환은 건너뜀)
+static std::u32string hostTypeEvents(uint8_t layout, const std::vector<KeyEvent>& events) {
+    std::map<uint8_t, HostKey> keys = hostLayout(layout);
+    std::u32string typed;
+    for (const KeyEvent& event : events) {
+        if (event.kind == KEY_EVENT_ENTER) {
+            typed += U'\n';
+        } else if (event.kind == KEY_EVENT_TAB) {
+            typed += U'\t';
+        } else if (event.kind == KEY_EVENT_CHAR) {
+            typed += hostType(keys, event.code, event.modifiers & ~KEY_CHAR_END);
+        }
+    }
+    return typed;
+}
+
+static void checkCompileRoundTrip(uint8_t layout, const char* text, const char32_t* expected) {
+    std::vector<KeyEvent> events;
+    KeystrokeCompiler::compile(text, strlen(text), events, layout);
+    std::u32string typed = hostTypeEvents(layout, events);
+    TEST_ASSERT_TRUE_MESSAGE(typed == expected, Keymap::name(layout));
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_us_table_round_trip() {
+    checkTableRoundTrip(LAYOUT_US);
+}
+
+void test_ko_table_round_trip() {
+    checkTableRoundTrip(LAYOUT_KO_2SET);
+}
+
+void test_de_table_round_trip() {
+    checkTableRoundTrip(LAYOUT_DE);
+}
+
+void test_dvorak_table_round_trip() {
+    checkTableRoundTrip(LAYOUT_DVORAK);
+}
+
+// 두벌식 자모 - 한 키 자모는 자판 위치, 겹자모는 두 자모의 키
+void test_jamo_round_trip() {
+    static const char32_t* const ROWS_BASE[] = { U"ㅂㅈㄷㄱㅅㅛㅕㅑㅐㅔ", U"ㅁㄴㅇㄹㅎㅗㅓㅏㅣ", U"ㅋㅌㅊㅍㅠㅜㅡ" };
+    static const char32_t* const ROWS_SHIFT[] = { U"ㅃㅉㄸㄲㅆ\0\0\0ㅒㅖ", U"", U"" };
+    static const size_t ROW_LENGTHS[] = { 10, 9, 7 };
+    static const uint8_t* const ROW_USAGES[] = { TOP_ROW.data(), HOME_ROW.data(), BOTTOM_ROW.data() + 1 };
+    std::map<uint32_t, std::pair<uint8_t, uint8_t>> single;  // 자모 → (키, 수정키)
+    for (size_t r = 0; r < 3; r++) {
+        for (size_t i = 0; i < ROW_LENGTHS[r]; i++) {
+            single[ROWS_BASE[r][i]] = { ROW_USAGES[r][i], 0 };
+            if (r == 0 && ROWS_SHIFT[r][i] != 0) {
+                single[ROWS_SHIFT[r][i]] = { ROW_USAGES[r][i], HID_MOD_LEFT_SHIFT };
+            }
+        }
+    }
+    static const char32_t* const COMPOUNDS[] = {
+        U"ㄳㄱㅅ", U"ㄵㄴㅈ", U"ㄶㄴㅎ", U"ㄺㄹㄱ", U"ㄻㄹㅁ", U"ㄼㄹㅂ", U"ㄽㄹㅅ", U"ㄾㄹㅌ", U"ㄿㄹㅍ", U"ㅀㄹㅎ",
+        U"ㅄㅂㅅ", U"ㅘㅗㅏ", U"ㅙㅗㅐ", U"ㅚㅗㅣ", U"ㅝㅜㅓ", U"ㅞㅜㅔ", U"ㅟㅜㅣ", U"ㅢㅡㅣ"
+    };
+
+    char message[32];
+    size_t checked = 0;
+    for (uint32_t jamo = HANGUL_JAMO_FIRST; jamo < HANGUL_JAMO_FIRST + HANGUL_JAMO_COUNT; jamo++) {
+        const KeyStroke* keys = Keymap::lookupJamo(jamo);
+        TEST_ASSERT_NOT_NULL(keys);
+        snprintf(message, sizeof(message), "U+%04X", (unsigned)jamo);
+        auto it = single.find(jamo);
+        if (it != single.end()) {
+            TEST_ASSERT_EQUAL_UINT8_MESSAGE(it->second.first, keys[0].usage, message);
+            TEST_ASSERT_EQUAL_UINT8_MESSAGE(it->second.second, keys[0].modifiers, message);
+            TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, keys[1].usage, message);
+            checked++;
+            continue;
+        }
+        for (const char32_t* compound : COMPOUNDS) {
+            if (compound[0] != jamo) {
+                continue;
+            }
+            for (size_t k = 0; k < 2; k++) {
+                TEST_ASSERT_EQUAL_UINT8_MESSAGE(single[compound[k + 1]].first, keys[k].usage, message);
+                TEST_ASSERT_EQUAL_UINT8_MESSAGE(single[compound[k + 1]].second, keys[k].modifiers, message);
+            }
+            checked++;
+        }
+    }
+    TEST_ASSERT_EQUAL(HANGUL_JAMO_COUNT, checked);
+}
+
+// 컴파일러 경로 - 표 조회, Enter/Tab, 배열별 특수 문자
+void test_compile_round_trip() {
+    checkCompileRoundTrip(LAYOUT_US, "Hello, World!\n\t{x} = [1, 2]; ~`", U"Hello, World!\n\t{x} = [1, 2]; ~`");
+    checkCompileRoundTrip(LAYOUT_KO_2SET, "abc@example.com 10% off", U"abc@example.com 10% off");
+    checkCompileRoundTrip(LAYOUT_DE, "Größe: 5µm | {a} @ß ~ <>", U"Größe: 5µm | {a} @ß ~ <>");
+    checkCompileRoundTrip(LAYOUT_DVORAK, "The quick brown fox; \"jumps\" - over/", U"The quick brown fox; \"jumps\" - over/");
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_us_table_round_trip);
+    RUN_TEST(test_ko_table_round_trip);
+    RUN_TEST(test_de_table_round_trip);
+    RUN_TEST(test_dvorak_table_round_trip);
+    RUN_TEST(test_jamo_round_trip);
+    RUN_TEST(test_compile_round_trip);
+    return UNITY_END();
+}
@@ -0,0 +1,277 @@
+/**
+ * @file test_main.cpp
+ * @brief 링크 관리 정책 테스트 (pio test -e native -f test_link_manager)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * LinkManager를 중앙 장치 흉내 스택(host/sim_link_stack.h)에 연결하고 시각을 직접 넘겨 가며
+ * 트래픽 종류별 상태 전환(연결 → 대량 → 완화 → 대량 → 해제), 요청 간격 제한,
+ * 거부 처리, 연결 직후의 DLE/2M PHY 요청을 확인합니다.
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <unity.h>
+#include <vector>
+#include "link_manager.h"
+#include "sim_link_stack.h"
+
+// 스택에 들어온 요청을 기록하고 흉내 스택에 넘김 (refuse: 요청을 보내지 못한 것으로 응답)
+class RecordingStack : public SimLinkStack {
+public:
+    struct Params {
+        uint16_t min_interval;
+        uint16_t max_interval;
+        uint16_t latency;
+        uint16_t timeout;
+    };
+
+    RecordingStack() : data_length_requests(0), last_data_length(0), phy_requests(0), refuse(false) {}
+
+    bool requestConnParams(uint16_t min_interval, uint16_t max_interval, uint16_t latency, uint16_t timeout) override {
+        params.push_back({ min_interval, max_interval, latency, timeout });
+        return !refuse && SimLinkStack::requestConnParams(min_interval, max_interval, latency, timeout);
+    }
+
+    bool requestDataLength(uint16_t tx_octets) override {
+        data_length_requests++;
+        last_data_length = tx_octets;
+        return !refuse && SimLinkStack::requestDataLength(tx_octets);
+    }
+
+    bool requestPhy2M() override {
+        phy_requests++;
+        return !refuse && SimLinkStack::requestPhy2M();
+    }
+
+    std::vector<Params> params;
+    int data_length_requests;
+    uint16_t last_data_length;
+    int phy_requests;
+    bool refuse;
+};
+
+static RecordingStack* stack;
+static LinkManager* manager;
+static StaticJsonDocument<512> stats;
+
+// 상태 보고를 읽어 stats에 담음
+static void readStats() {
+    stats.clear();
+    TEST_ASSERT_FALSE(deserializeJson(stats, manager->statsJson()));
+}
+
+static void assertMode(const char* mode) {
+    readStats();
+    TEST_ASSERT_EQUAL_STRING(mode, stats["mode"] | "");
+}
+
+// 경로 태스크처럼 LINK_TICK_MS마다 주기 확인과 스택 이벤트 전달
+static void runUntil(uint32_t& now, uint32_t until) {
+    while (now < until) {
+        now += LINK_TICK_MS;
+        manager->tick(now);
+        stack->poll(*manager);
+    }
+}
+
+static void receive(const char* text, uint32_t now) {
+    manager->received((const uint8_t*)text, strlen(text), now);
+    stack->poll(*manager);
+}
+
+static void receiveFrame(uint8_t type, size_t length, uint32_t now) {
+    std::vector<uint8_t> frame(length, 'x');
+    frame[0] = FRAME_MARKER;
+    frame[1] = type;
+    manager->received(frame.data(), frame.size(), now);
+    stack->poll(*manager);
+}
+
+static void assertParams(const RecordingStack::Params& p, uint16_t min_interval, uint16_t max_interval,
+                         uint16_t latency, uint16_t timeout) {
+    TEST_ASSERT_EQUAL_UINT16(min_interval, p.min_interval);
+    TEST_ASSERT_EQUAL_UINT16(max_interval, p.max_interval);
+    TEST_ASSERT_EQUAL_UINT16(latency, p.latency);
+    TEST_ASSERT_EQUAL_UINT16(timeout, p.timeout);
+}
+
+void setUp() {
+    stack = new RecordingStack();
+    manager = new LinkManager(*stack);
+    manager->initialize();
+}
+
+void tearDown() {
+    delete manager;
+    delete stack;
+}
+
+void test_bulk_classification() {
+    uint8_t frame[4] = { FRAME_MARKER, 0, 0, 0 };
+    for (uint8_t type : { FRAME_CHUNK_BEGIN, FRAME_CHUNK_CONTINUE, FRAME_STREAM_BEGIN, FRAME_STREAM_CONTINUE, FRAME_SEQUENCED }) {
+        frame[1] = type;
+        TEST_ASSERT_TRUE(LinkManager::isBulk(frame, sizeof(frame)));
+    }
+    frame[1] = FRAME_MIRROR_KEYS;
+    TEST_ASSERT_FALSE(LinkManager::isBulk(frame, sizeof(frame)));
+
+    std::vector<uint8_t> text(LINK_BULK_MESSAGE_BYTES, 'a');
+    TEST_ASSERT_FALSE(LinkManager::isBulk(text.data(), text.size()));
+    text.push_back('a');
+    TEST_ASSERT_TRUE(LinkManager::isBulk(text.data(), text.size()));
+}
+
+// 연결 직후 - DLE 최대 길이와 2M PHY를 한 번 요청, 빠른 간격(광고의 선호 간격)으로 시작
+void test_connect_requests_dle_and_2m_phy() {
+    assertMode("down");
+    manager->connected(0);
+    TEST_ASSERT_EQUAL(1, stack->data_length_requests);
+    TEST_ASSERT_EQUAL_UINT16(BLE_DATA_LENGTH_MAX, stack->last_data_length);
+    TEST_ASSERT_EQUAL(1, stack->phy_requests);
+    TEST_ASSERT_EQUAL(0, stack->params.size());
+    TEST_ASSERT_TRUE(manager->bulk());
+
+    stack->poll(*manager);
+    readStats();
+    TEST_ASSERT_EQUAL_STRING("bulk", stats["mode"] | "");
+    TEST_ASSERT_EQUAL(SIM_CENTRAL_DATA_LENGTH, stats["tx_octets"] | 0);
+    TEST_ASSERT_EQUAL(SIM_CENTRAL_DATA_LENGTH, stats["rx_octets"] | 0);
+    TEST_ASSERT_EQUAL_STRING("2M", stats["phy"] | "");
+    TEST_ASSERT_EQUAL(2, stats["requests"] | 0);
+    TEST_ASSERT_EQUAL(0, stats["rejected"] | 0);
+
+    // DLE/PHY는 완화해도 다시 요청하지 않음
+    uint32_t now = 0;
+    runUntil(now, LINK_RELAX_AFTER_MS + 2 * LINK_TICK_MS);
+    assertMode("idle");
+    TEST_ASSERT_EQUAL(1, stack->data_length_requests);
+    TEST_ASSERT_EQUAL(1, stack->phy_requests);
+}
+
+// 대량 → 완화 → 대량 전환과 요청한 파라미터
+void test_traffic_transitions() {
+    uint32_t now = 0;
+    manager->connected(now);
+    stack->poll(*manager);
+
+    // 작은 제어 메시지는 대량 전송이 아님 - LINK_RELAX_AFTER_MS 뒤 완화
+    receive("GHTYPE_STS", 500);
+    runUntil(now, LINK_RELAX_AFTER_MS);
+    assertMode("bulk");
+    TEST_ASSERT_EQUAL(0, stack->params.size());
+    runUntil(now, LINK_RELAX_AFTER_MS + LINK_TICK_MS);
+    assertMode("idle");
+    TEST_ASSERT_EQUAL(1, stack->params.size());
+    assertParams(stack->params[0], BLE_IDLE_MIN_CONN_INTERVAL, BLE_IDLE_MAX_CONN_INTERVAL,
+                 BLE_IDLE_SLAVE_LATENCY, BLE_IDLE_TIMEOUT);
+    readStats();
+    TEST_ASSERT_EQUAL(BLE_IDLE_MIN_CONN_INTERVAL * 1250, stats["interval_us"] | 0);
+    TEST_ASSERT_EQUAL(BLE_IDLE_SLAVE_LATENCY, stats["latency"] | 0);
+    TEST_ASSERT_EQUAL(BLE_IDLE_TIMEOUT * 10, stats["timeout_ms"] | 0);
+
+    // 유휴 중 작은 메시지는 상태를 바꾸지 않음
+    now += LINK_REQUEST_GAP_MS;
+    receive("{\"text\":\"hi\"}", now);
+    assertMode("idle");
+    TEST_ASSERT_EQUAL(1, stack->params.size());
+
+    // 청크 프레임 - 빠른 간격 요청 (흉내 중앙 장치는 15ms로 올려 받음)
+    receiveFrame(FRAME_CHUNK_BEGIN, 64, now);
+    assertMode("bulk");
+    TEST_ASSERT_EQUAL(2, stack->params.size());
+    assertParams(stack->params[1], BLE_MIN_CONN_INTERVAL, BLE_MAX_CONN_INTERVAL, 0, BLE_TIMEOUT_MULTIPLIER);
+    readStats();
+    TEST_ASSERT_EQUAL(SIM_CENTRAL_MIN_INTERVAL * 1250, stats["interval_us"] | 0);
+    TEST_ASSERT_EQUAL(0, stats["latency"] | 0);
+
+    // 대량 전송이 이어지는 동안은 완화하지 않음
+    uint32_t until = now + 2 * LINK_RELAX_AFTER_MS;
+    while (now < until) {
+        runUntil(now, now + LINK_RELAX_AFTER_MS / 2);
+        receiveFrame(FRAME_STREAM_CONTINUE, 200, now);
+        assertMode("bulk");
+    }
+    TEST_ASSERT_EQUAL(2, stack->params.size());
+
+    // 큰 일반 메시지도 대량 전송 - 완화 후 다시 진입
+    runUntil(now, now + LINK_RELAX_AFTER_MS + LINK_TICK_MS);
+    assertMode("idle");
+    now += LINK_REQUEST_GAP_MS;
+    std::string large(LINK_BULK_MESSAGE_BYTES + 1, 'a');
+    receive(large.c_str(), now);
+    assertMode("bulk");
+    TEST_ASSERT_EQUAL(4, stack->params.size());
+    readStats();
+    TEST_ASSERT_GREATER_THAN(0, stats["burst_bps"] | 0);
+}
+
+// LINK_REQUEST_GAP_MS 안의 요청은 주기 확인까지 미룸
+void test_request_gap_defers() {
+    uint32_t now = 0;
+    manager->connected(now);
+    runUntil(now, LINK_RELAX_AFTER_MS + LINK_TICK_MS);
+    assertMode("idle");
+    TEST_ASSERT_EQUAL(1, stack->params.size());
+    uint32_t relaxed_at = now;
+
+    // 완화 요청 직후 대량 전송 - 바로 요청하지 않음
+    receiveFrame(FRAME_SEQUENCED, 32, now + 10);
+    assertMode("bulk");
+    TEST_ASSERT_EQUAL(1, stack->params.size());
+
+    // 간격이 지난 첫 주기 확인에서 요청
+    runUntil(now, relaxed_at + LINK_REQUEST_GAP_MS - LINK_TICK_MS);
+    TEST_ASSERT_EQUAL(1, stack->params.size());
+    runUntil(now, relaxed_at + LINK_REQUEST_GAP_MS);
+    TEST_ASSERT_EQUAL(2, stack->params.size());
+    assertParams(stack->params[1], BLE_MIN_CONN_INTERVAL, BLE_MAX_CONN_INTERVAL, 0, BLE_TIMEOUT_MULTIPLIER);
+}
+
+// 스택이 보내지 못하거나 중앙 장치가 거부한 요청은 rejected로 셈
+void test_rejections_counted() {
+    stack->refuse = true;
+    manager->connected(0);
+    readStats();
+    TEST_ASSERT_EQUAL(2, stats["requests"] | 0);
+    TEST_ASSERT_EQUAL(2, stats["rejected"] | 0);
+    TEST_ASSERT_EQUAL_STRING("1M", stats["phy"] | "");
+
+    stack->refuse = false;
+    manager->paramsUpdated(false, 0, 0, 0);
+    readStats();
+    TEST_ASSERT_EQUAL(3, stats["rejected"] | 0);
+    TEST_ASSERT_EQUAL(0, stats["interval_us"] | 0);
+}
+
+// 해제 - 주기 확인은 아무것도 요청하지 않고, 다시 연결하면 DLE/PHY부터 새로
+void test_disconnect_and_reconnect() {
+    uint32_t now = 0;
+    manager->connected(now);
+    stack->poll(*manager);
+    manager->disconnected();
+    stack->reset();
+    assertMode("down");
+    runUntil(now, 2 * LINK_RELAX_AFTER_MS);
+    receiveFrame(FRAME_CHUNK_BEGIN, 64, now);
+    assertMode("down");
+    TEST_ASSERT_EQUAL(0, stack->params.size());
+
+    manager->connected(now);
+    TEST_ASSERT_EQUAL(2, stack->data_length_requests);
+    TEST_ASSERT_EQUAL(2, stack->phy_requests);
+    readStats();
+    TEST_ASSERT_EQUAL_STRING("1M", stats["phy"] | "");  // 결과가 오기 전에는 모름
+    TEST_ASSERT_EQUAL(0, stats["tx_octets"] | 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bulk_classification);
+    RUN_TEST(test_connect_requests_dle_and_2m_phy);
+    RUN_TEST(test_traffic_transitions);
+    RUN_TEST(test_request_gap_defers);
+    RUN_TEST(test_rejections_counted);
+    RUN_TEST(test_disconnect_and_reconnect);
+    return UNITY_END();
+}
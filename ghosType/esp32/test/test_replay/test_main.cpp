@@ -0,0 +1,54 @@
+/**
+ * @file test_main.cpp
+ * @brief 기준 트레이스 재생 테스트 (pio test -e native -f test_replay)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * golden.script를 펌웨어(setup()/loop())에 재생해 응답과 HID 리포트 열을 golden.trace와 비교하고,
+ * 구간마다 @budget의 지연/처리량 예산(가상 시계 기준)을 넘지 않는지 확인합니다.
+ * 동작을 의도적으로 바꿨다면 호스트 빌드의 --replay ... --record로 기준 트레이스를 다시 만들어 함께 커밋합니다.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <unistd.h>
+#include "host_options.h"
+
+void setup();
+void loop();
+
+// 이 파일 옆의 데이터 파일 경로
+static std::string testFile(const char* name) {
+    std::string path(__FILE__);
+    size_t slash = path.rfind('/');
+    return (slash == std::string::npos ? std::string() : path.substr(0, slash + 1)) + name;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_golden_replay() {
+    static const std::string script = testFile("golden.script");
+    static const std::string golden = testFile("golden.trace");
+    hostOptions.socket_path = NULL;
+    hostOptions.virtual_clock = true;
+    hostOptions.replay_path = script.c_str();
+    hostOptions.golden_path = golden.c_str();
+
+    setup();
+    while (hostOptions.replay_result < 0) {
+        loop();
+    }
+    // 실패한 구간과 다른 첫 줄은 재생 경로가 표준 오류로 보고
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, hostOptions.replay_result, "trace differs or a budget was exceeded");
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_golden_replay);
+    int failures = UNITY_END();
+    fflush(stdout);
+    fflush(stderr);
+    _exit(failures);  // 펌웨어 태스크가 도는 중이므로 정적 소멸자를 거치지 않고 종료
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_main.cpp
+ * @brief 라이브 미러 편집 → 키 입력 변환 테스트 (pio test -e native -f test_shadow_text)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * ShadowText가 만든 키 열을 호스트 편집기 흉내(커서와 ←/→, Backspace, Delete만 해석)에 입력해
+ * 호스트 텍스트가 클라이언트 텍스트와 같은지, 키를 보내지 않는 편집 뒤에도 커서가 맞는지 확인합니다.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "shadow_text.h"
+
+// 편집용 HID 키 (shadow_text.cpp와 동일)
+#define KEY_BACKSPACE 0x2A
+#define KEY_DELETE 0x4C
+#define KEY_RIGHT 0x4F
+#define KEY_LEFT 0x50
+
+// 호스트 편집기 흉내 - 글자 키는 키 이벤트 그대로 텍스트에 들어감
+struct HostEditor {
+    std::vector<KeyEvent> text;
+    size_t cursor = 0;
+
+    void type(const std::vector<KeyEvent>& events) {
+        for (const KeyEvent& event : events) {
+            if (event.kind != KEY_EVENT_CHAR) {
+                continue;
+            }
+            switch (event.code) {
+                case KEY_LEFT:      cursor -= cursor > 0 ? 1 : 0; break;
+                case KEY_RIGHT:     cursor += cursor < text.size() ? 1 : 0; break;
+                case KEY_BACKSPACE: if (cursor > 0) { text.erase(text.begin() + --cursor); } break;
+                case KEY_DELETE:    if (cursor < text.size()) { text.erase(text.begin() + cursor); } break;
+                default:            text.insert(text.begin() + cursor++, event); break;
+            }
+        }
+    }
+};
+
+static ShadowText shadow;
+static HostEditor host;
+static CompileContext context;
+
+// 클라이언트 텍스트 [start, end)를 text로 바꾸고 보낸 키를 호스트에 입력
+static std::vector<KeyEvent> edit(uint32_t start, uint32_t end, const char* text, uint8_t layout = LAYOUT_US) {
+    std::vector<KeyEvent> keys;
+    TEST_ASSERT_TRUE(shadow.replace(start, end, text, strlen(text), layout, context, keys));
+    host.type(keys);
+    return keys;
+}
+
+static size_t countKey(const std::vector<KeyEvent>& keys, uint8_t usage) {
+    size_t count = 0;
+    for (const KeyEvent& key : keys) {
+        count += key.code == usage ? 1 : 0;
+    }
+    return count;
+}
+
+// 호스트 텍스트가 expected를 처음부터 입력한 것과 같음
+static void assertHostText(const char* expected) {
+    std::vector<KeyEvent> typed;
+    KeystrokeCompiler::compile(expected, strlen(expected), typed, LAYOUT_US);
+    TEST_ASSERT_EQUAL_MESSAGE(typed.size(), host.text.size(), expected);
+    for (size_t i = 0; i < typed.size(); i++) {
+        TEST_ASSERT_EQUAL_MESSAGE(typed[i].code, host.text[i].code, expected);
+        TEST_ASSERT_EQUAL_MESSAGE(typed[i].modifiers, host.text[i].modifiers, expected);
+    }
+}
+
+void setUp() {
+    shadow.clear();
+    host = HostEditor();
+    context = { IME_MODE_UNKNOWN, 0 };
+}
+
+void tearDown() {}
+
+// 끝부분 교체는 Backspace + 새 글자만
+void test_replace_tail() {
+    edit(0, 0, "hello world");
+    std::vector<KeyEvent> keys = edit(6, 11, "there");
+    TEST_ASSERT_EQUAL(5, countKey(keys, KEY_BACKSPACE));
+    TEST_ASSERT_EQUAL(0, countKey(keys, KEY_LEFT) + countKey(keys, KEY_RIGHT));
+    TEST_ASSERT_EQUAL(10, keys.size());
+    assertHostText("hello there");
+}
+
+// 같은 글자로 바꾸는 편집은 키를 보내지 않고 커서도 옮기지 않음 - 다음 편집이 제자리에 들어감
+void test_noop_edit_keeps_cursor() {
+    edit(0, 0, "hello world");
+    TEST_ASSERT_EQUAL(0, edit(0, 5, "hello").size());
+    TEST_ASSERT_EQUAL_UINT32(11, shadow.cursor());
+
+    std::vector<KeyEvent> keys = edit(7, 7, "X");
+    TEST_ASSERT_EQUAL(4, countKey(keys, KEY_LEFT));
+    TEST_ASSERT_EQUAL(0, countKey(keys, KEY_RIGHT));
+    assertHostText("hello wXorld");
+}
+
+// 입력되지 않은 글자(us 배열의 한글)만 지우는 편집도 키 없이 끝나고 커서는 호스트와 같은 자리
+void test_absent_only_edit_keeps_cursor() {
+    edit(0, 0, "a\xED\x95\x9C" "b");  // "a한b" - 호스트에는 "ab"
+    assertHostText("ab");
+    TEST_ASSERT_EQUAL(0, edit(1, 2, "").size());
+
+    std::vector<KeyEvent> keys = edit(1, 1, "X");
+    TEST_ASSERT_EQUAL(1, countKey(keys, KEY_LEFT));
+    assertHostText("aXb");
+}
+
+// 앞쪽 오타 한 글자는 커서 이동 + 2키, 이어서 끝에 입력하면 끝으로 돌아감
+void test_front_typo_then_append() {
+    edit(0, 0, "hello world");
+    std::vector<KeyEvent> keys = edit(1, 2, "a");
+    TEST_ASSERT_EQUAL(2, keys.size() - countKey(keys, KEY_LEFT));
+    assertHostText("hallo world");
+
+    edit(11, 11, "!");
+    assertHostText("hallo world!");
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_replace_tail);
+    RUN_TEST(test_noop_edit_keeps_cursor);
+    RUN_TEST(test_absent_only_edit_keeps_cursor);
+    RUN_TEST(test_front_typo_then_append);
+    return UNITY_END();
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_main.cpp
+ * @brief 스트림 수신 흐름 제어 테스트 (pio test -e native -f test_stream_ingest)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 링 버퍼(호스트 빌드는 STREAM_RING_EVENTS)보다 긴 스트림을 보내
+ * 일시 정지/재개로 빠짐없이 전달되는지, 정지를 무시할 때만 중단되는지 확인합니다.
+ * 타이핑 루프 대신 테스트가 링 버퍼를 비웁니다.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "stream_ingest.h"
+
+static const size_t FRAME_BYTES = 200;  // 클라이언트 한 번의 쓰기
+
+static StreamIngest stream;
+
+// 타이핑 루프 흉내 - 링 버퍼에서 count개까지 꺼냄
+static size_t drain(std::string& typed, size_t count) {
+    KeyEvent event;
+    size_t taken = 0;
+    while (taken < count && stream.next(event)) {
+        typed += event.code == 0x04 ? 'a' : '?';  // us 배열의 'a'
+        taken++;
+    }
+    return taken;
+}
+
+void setUp() {
+    if (stream.active()) {
+        stream.end();
+    }
+    TEST_ASSERT_TRUE(stream.begin(LAYOUT_US));
+}
+
+void tearDown() {}
+
+// 링 버퍼의 세 배 - 정지 알림을 따르는 클라이언트는 끝까지 전달
+void test_stream_longer_than_ring_pauses_and_resumes() {
+    const size_t total = STREAM_RING_EVENTS * 3;
+    const std::string frame(FRAME_BYTES, 'a');
+    std::string typed;
+    size_t sent = 0;
+    size_t resumes = 0;
+
+    while (sent < total) {
+        size_t length = MIN(FRAME_BYTES, total - sent);
+        TEST_ASSERT_TRUE(stream.feed((const uint8_t*)frame.data(), length));
+        sent += length;
+        // 타이핑은 수신보다 느림 - 한 조각마다 절반만 입력
+        drain(typed, length / 2);
+        while (stream.paused()) {
+            // 클라이언트는 STREAM:resume까지 기다리고 그동안 타이핑 루프가 비움
+            drain(typed, 64);
+            if (stream.refillDue() && stream.refill()) {
+                resumes++;
+            }
+        }
+    }
+    TEST_ASSERT_TRUE(stream.finish());
+    while (!stream.drained()) {
+        drain(typed, 64);
+    }
+
+    TEST_ASSERT_FALSE(stream.overflowed());
+    TEST_ASSERT_EQUAL(total, typed.size());
+    TEST_ASSERT_TRUE(typed == std::string(total, 'a'));  // 순서대로, 빠짐없이
+    TEST_ASSERT_TRUE(resumes > 0);
+}
+
+// 한 조각이 링 버퍼를 넘으면 나머지는 보관했다가 끝 프레임 뒤에도 모두 입력
+void test_finish_waits_for_backlog() {
+    const std::string frame(STREAM_RING_EVENTS + 500, 'a');
+    TEST_ASSERT_TRUE(stream.feed((const uint8_t*)frame.data(), frame.size()));
+    TEST_ASSERT_TRUE(stream.paused());
+    TEST_ASSERT_TRUE(stream.finish());
+    TEST_ASSERT_FALSE(stream.drained());
+
+    std::string typed;
+    while (!stream.drained()) {
+        drain(typed, 256);
+        if (stream.refillDue()) {
+            TEST_ASSERT_FALSE(stream.refill());  // 끝 프레임을 받았으므로 재개 알림 없음
+        }
+    }
+    TEST_ASSERT_EQUAL(frame.size(), typed.size());
+}
+
+// 정지를 무시하고 계속 보내면 보관분 한도에서 중단
+void test_ignoring_pause_overflows() {
+    const std::string frame(FRAME_BYTES, 'a');
+    size_t sent = 0;
+    bool ok = true;
+    while (ok && sent < STREAM_RING_EVENTS * 4) {
+        ok = stream.feed((const uint8_t*)frame.data(), frame.size());
+        sent += frame.size();
+    }
+    TEST_ASSERT_FALSE(ok);
+    TEST_ASSERT_TRUE(stream.overflowed());
+    TEST_ASSERT_TRUE(sent > STREAM_RING_EVENTS + STREAM_BACKLOG_EVENTS);
+    TEST_ASSERT_FALSE(stream.feed((const uint8_t*)frame.data(), frame.size()));
+}
+
+int main(int argc, char** argv) {
+    stream.initialize();
+    UNITY_BEGIN();
+    RUN_TEST(test_stream_longer_than_ring_pauses_and_resumes);
+    RUN_TEST(test_finish_waits_for_backlog);
+    RUN_TEST(test_ignoring_pause_overflows);
+    return UNITY_END();
+}
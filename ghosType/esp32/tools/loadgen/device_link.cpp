@@ -0,0 +1,156 @@
+/**
+ * @file device_link.cpp
+ * @brief 부하 생성기 장치 연결 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "device_link.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "config.h"
+
+void DeviceLink::close() {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 유닉스 소켓
+
+bool SocketLink::open() {
+    close();
+    outbox.clear();
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0);
+    if (fd < 0) {
+        return false;
+    }
+    if (connect(fd, (sockaddr*)&address, sizeof(address)) != 0) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool SocketLink::flush() {
+    while (!outbox.empty()) {
+        const std::string& message = outbox.front();
+        ssize_t written = send(fd, message.data(), message.size(), MSG_NOSIGNAL);
+        if (written < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        outbox.pop_front();  // SEQPACKET은 메시지 단위로 전송되므로 일부만 보내지는 경우 없음
+    }
+    return true;
+}
+
+bool SocketLink::receive(std::vector<std::string>& replies) {
+    char buffer[MAX_MESSAGE_BYTES];
+    while (true) {
+        ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+        if (length > 0) {
+            replies.emplace_back(buffer, (size_t)length);
+        } else if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        } else {
+            return false;  // 상대가 닫음
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// USB CDC 시리얼
+
+bool CdcLink::open() {
+    close();
+    outbox.clear();
+    sent = 0;
+    inbox.clear();
+
+    fd = ::open(device.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) {
+        return false;
+    }
+    // 원시 모드 (줄 단위 처리, 에코, 문자 변환 없음) - USB CDC는 보율과 무관
+    termios settings = {};
+    if (tcgetattr(fd, &settings) == 0) {
+        cfmakeraw(&settings);
+        settings.c_cflag |= CLOCAL | CREAD;
+        tcsetattr(fd, TCSANOW, &settings);
+    }
+    // 장치가 DTR로 연결을 판단하므로 열 때 이전 수신 데이터는 버림
+    tcflush(fd, TCIOFLUSH);
+    return true;
+}
+
+void CdcLink::queue(const std::string& message) {
+    if (sent == outbox.size()) {
+        outbox.clear();
+        sent = 0;
+    }
+    outbox += (char)CDC_FRAME_SYNC;
+    outbox += (char)(message.size() & 0xFF);
+    outbox += (char)((message.size() >> 8) & 0xFF);
+    outbox += message;
+}
+
+bool CdcLink::flush() {
+    while (sent < outbox.size()) {
+        ssize_t written = write(fd, outbox.data() + sent, outbox.size() - sent);
+        if (written < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        sent += (size_t)written;
+    }
+    return true;
+}
+
+bool CdcLink::receive(std::vector<std::string>& replies) {
+    char buffer[4096];
+    while (true) {
+        ssize_t length = read(fd, buffer, sizeof(buffer));
+        if (length > 0) {
+            inbox.append(buffer, (size_t)length);
+        } else if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            return false;  // 장치 분리
+        }
+    }
+
+    // 완성된 프레임 꺼내기 - 동기 바이트가 아닌 바이트(디버그 출력 등)는 건너뜀
+    size_t i = 0;
+    while (i < inbox.size()) {
+        if ((uint8_t)inbox[i] != CDC_FRAME_SYNC) {
+            i++;
+            continue;
+        }
+        if (inbox.size() - i < 3) {
+            break;
+        }
+        size_t length = (uint8_t)inbox[i + 1] | ((uint8_t)inbox[i + 2] << 8);
+        if (length == 0 || length > MAX_MESSAGE_BYTES) {
+            i++;  // 잘못된 길이 - 다음 동기 바이트에서 다시 맞춤
+            continue;
+        }
+        if (inbox.size() - i - 3 < length) {
+            break;
+        }
+        replies.push_back(inbox.substr(i + 3, length));
+        i += 3 + length;
+    }
+    inbox.erase(0, i);
+    return true;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file device_link.h
+ * @brief 부하 생성기와 장치(또는 호스트 빌드) 사이의 연결
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 두 가지 경로를 지원합니다.
+ *   - 소켓: 호스트 빌드의 유닉스 소켓 (SOCK_SEQPACKET, 메시지 하나 = BLE 쓰기 하나)
+ *   - CDC: 동글의 USB CDC 시리얼 포트 ([CDC_FRAME_SYNC][길이 u16 LE][메시지] 프레임)
+ *
+ * 송수신은 모두 논블로킹입니다. 장치가 응답을 보내느라 막혀 있는 동안 부하 생성기도
+ * 전송에서 막히면 서로 기다리게 되므로, 보낼 데이터는 내부에 쌓아 두고 쓸 수 있을 때 씁니다.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include <deque>
+
+/**
+ * @brief 장치 연결 기본 클래스
+ */
+class DeviceLink {
+public:
+    virtual ~DeviceLink() {}
+
+    virtual const char* name() const = 0;
+
+    /**
+     * @brief 연결 (끊긴 뒤 다시 호출 가능)
+     * @return true 연결됨
+     */
+    virtual bool open() = 0;
+
+    void close();
+
+    bool isOpen() const { return fd >= 0; }
+
+    /**
+     * @brief poll()에 넣을 파일 기술자
+     */
+    int handle() const { return fd; }
+
+    /**
+     * @brief 메시지 하나를 보낼 목록에 추가 (실제 전송은 flush)
+     */
+    virtual void queue(const std::string& message) = 0;
+
+    /**
+     * @brief 아직 보내지 못한 데이터가 있는지
+     */
+    virtual bool hasPending() const = 0;
+
+    /**
+     * @brief 쓸 수 있는 만큼 전송
+     * @return false 연결 끊김
+     */
+    virtual bool flush() = 0;
+
+    /**
+     * @brief 읽을 수 있는 만큼 응답을 읽어 replies에 추가
+     * @return false 연결 끊김
+     */
+    virtual bool receive(std::vector<std::string>& replies) = 0;
+
+protected:
+    DeviceLink() : fd(-1) {}
+
+    int fd;
+};
+
+/**
+ * @brief 호스트 빌드의 유닉스 소켓 연결
+ */
+class SocketLink : public DeviceLink {
+public:
+    explicit SocketLink(const std::string& path) : path(path) {}
+
+    const char* name() const override { return "sock"; }
+    bool open() override;
+    void queue(const std::string& message) override { outbox.push_back(message); }
+    bool hasPending() const override { return !outbox.empty(); }
+    bool flush() override;
+    bool receive(std::vector<std::string>& replies) override;
+
+private:
+    std::string path;
+    std::deque<std::string> outbox;
+};
+
+/**
+ * @brief 동글의 USB CDC 시리얼 연결
+ */
+class CdcLink : public DeviceLink {
+public:
+    explicit CdcLink(const std::string& device) : device(device) {}
+
+    const char* name() const override { return "cdc"; }
+    bool open() override;
+    void queue(const std::string& message) override;
+    bool hasPending() const override { return sent < outbox.size(); }
+    bool flush() override;
+    bool receive(std::vector<std::string>& replies) override;
+
+private:
+    std::string device;
+    std::string outbox;     ///< 프레임으로 만든 전송 대기 바이트
+    size_t sent = 0;        ///< outbox에서 이미 보낸 바이트 수
+    std::string inbox;      ///< 아직 프레임이 완성되지 않은 수신 바이트
+};
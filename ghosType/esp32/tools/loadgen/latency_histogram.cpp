@@ -0,0 +1,77 @@
+/**
+ * @file latency_histogram.cpp
+ * @brief 고정 크기 로그 구간 지연 히스토그램 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "latency_histogram.h"
+#include <string.h>
+
+void LatencyHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+    total = 0;
+    sum = 0;
+    maximum = 0;
+}
+
+size_t LatencyHistogram::bucketOf(uint64_t us) {
+    if (us < LATENCY_SUB_BUCKETS) {
+        return (size_t)us;  // 16us 미만은 1us 단위
+    }
+    size_t exponent = 63 - __builtin_clzll(us);
+    if (exponent > LATENCY_MAX_EXPONENT) {
+        return LATENCY_BUCKETS - 1;
+    }
+    size_t sub = (size_t)(us >> (exponent - LATENCY_SUB_BITS)) & (LATENCY_SUB_BUCKETS - 1);
+    return LATENCY_SUB_BUCKETS * (exponent - LATENCY_SUB_BITS + 1) + sub;
+}
+
+uint64_t LatencyHistogram::upperBound(size_t bucket) {
+    if (bucket < LATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+    size_t exponent = bucket / LATENCY_SUB_BUCKETS + LATENCY_SUB_BITS - 1;
+    uint64_t sub = bucket % LATENCY_SUB_BUCKETS;
+    return ((LATENCY_SUB_BUCKETS + sub + 1) << (exponent - LATENCY_SUB_BITS)) - 1;
+}
+
+void LatencyHistogram::record(uint64_t us) {
+    buckets[bucketOf(us)]++;
+    total++;
+    sum += us;
+    if (us > maximum) {
+        maximum = us;
+    }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+        buckets[i] += other.buckets[i];
+    }
+    total += other.total;
+    sum += other.sum;
+    if (other.maximum > maximum) {
+        maximum = other.maximum;
+    }
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const {
+    if (total == 0) {
+        return 0;
+    }
+    uint64_t rank = (uint64_t)(percent / 100.0 * total + 0.5);
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            // 구간 상한이 실제 최대값보다 크면 최대값으로
+            uint64_t bound = upperBound(i);
+            return bound < maximum ? bound : maximum;
+        }
+    }
+    return maximum;
+}
@@ -0,0 +1,373 @@
+/**
+ * @file loadgen.cpp
+ * @brief 장치 프로토콜 부하 생성기 / 장시간 부하 시험 도구
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 호스트 빌드의 유닉스 소켓 또는 동글의 USB CDC 포트로 작업(JSON, 접두사 형식), 제어 명령,
+ * 잘못된 메시지를 섞어 정해진 속도로 보내고, 구간마다 처리량, 거부율, 지연 백분위를 출력합니다.
+ *
+ * 사용법: loadgen [--socket 경로 | --cdc 장치] [옵션...] (--help로 목록)
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include "config.h"
+#include "device_link.h"
+#include "reply_tracker.h"
+#include "workload.h"
+
+namespace {
+
+constexpr const char* DEFAULT_SOCKET_PATH = "/tmp/ghostype.sock";
+constexpr uint64_t RECONNECT_INTERVAL_US = 1000000;
+constexpr int MAX_POLL_WAIT_MS = 100;
+constexpr uint64_t STATUS_WAIT_US = 3000000;
+
+struct Options {
+    std::string socket_path = DEFAULT_SOCKET_PATH;
+    std::string cdc_device;
+    double duration_s = 60;       ///< 0: Ctrl-C까지
+    double rate = 20;             ///< 초당 메시지 수 (0: 제한 없음)
+    bool poisson = false;         ///< 도착 간격을 지수 분포로
+    unsigned burst = 0;           ///< 버스트 하나의 메시지 수
+    double burst_every_s = 0;     ///< 버스트 간격
+    size_t window = 0;            ///< 끝나지 않은 작업 수 상한 (0: 제한 없음)
+    double report_s = 10;
+    double drain_s = 10;          ///< 끝난 뒤 남은 응답을 기다리는 시간
+    uint64_t seed = 1;
+    WorkloadOptions workload;
+};
+
+volatile sig_atomic_t stopRequested = 0;
+
+void onSignal(int) {
+    stopRequested = 1;
+}
+
+uint64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void usage(const char* program) {
+    fprintf(stderr,
+        "usage: %s [--socket path | --cdc device] [options]\n"
+        "  --socket PATH        host build socket (default %s)\n"
+        "  --cdc DEVICE         dongle USB CDC port (e.g. /dev/ttyACM0)\n"
+        "  --duration SEC       run time, 0 = until Ctrl-C (default 60)\n"
+        "  --rate N             messages per second, 0 = as fast as possible (default 20)\n"
+        "  --poisson            exponential inter-arrival times instead of a fixed interval\n"
+        "  --burst N            extra back-to-back messages per burst\n"
+        "  --burst-every SEC    burst interval\n"
+        "  --window N           max unfinished jobs in flight, 0 = open loop (default 0)\n"
+        "  --size SPEC          text length in code points: fixed:N | uniform:MIN:MAX | exp:MEAN (default exp:64)\n"
+        "  --korean F           fraction of Korean words, 0..1 (default 0.5)\n"
+        "  --form F             json | prefix | mixed (default json)\n"
+        "  --control F          fraction of control commands (default 0.05)\n"
+        "  --malformed F        fraction of malformed messages (default 0.05)\n"
+        "  --speed CPS          speed_cps for JSON jobs and config commands\n"
+        "  --layout NAME        layout for JSON jobs (us, ko, de, dvorak)\n"
+        "  --report SEC         report interval (default 10)\n"
+        "  --drain SEC          wait for outstanding replies at the end (default 10)\n"
+        "  --seed N             random seed (default 1)\n",
+        program, DEFAULT_SOCKET_PATH);
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    options.workload.size.parse("exp:64");
+    options.workload.max_bytes = MAX_MESSAGE_BYTES;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        bool takes_value = true;
+
+        if (strcmp(arg, "--poisson") == 0) {
+            options.poisson = true;
+            takes_value = false;
+        } else if (!value) {
+            return false;
+        } else if (strcmp(arg, "--socket") == 0) {
+            options.socket_path = value;
+        } else if (strcmp(arg, "--cdc") == 0) {
+            options.cdc_device = value;
+        } else if (strcmp(arg, "--duration") == 0) {
+            options.duration_s = atof(value);
+        } else if (strcmp(arg, "--rate") == 0) {
+            options.rate = atof(value);
+        } else if (strcmp(arg, "--burst") == 0) {
+            options.burst = (unsigned)atoi(value);
+        } else if (strcmp(arg, "--burst-every") == 0) {
+            options.burst_every_s = atof(value);
+        } else if (strcmp(arg, "--window") == 0) {
+            options.window = (size_t)atoi(value);
+        } else if (strcmp(arg, "--size") == 0) {
+            if (!options.workload.size.parse(value)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--korean") == 0) {
+            options.workload.korean = atof(value);
+        } else if (strcmp(arg, "--form") == 0) {
+            if (strcmp(value, "json") == 0) {
+                options.workload.form = FORM_JSON;
+            } else if (strcmp(value, "prefix") == 0) {
+                options.workload.form = FORM_PREFIX;
+            } else if (strcmp(value, "mixed") == 0) {
+                options.workload.form = FORM_MIXED;
+            } else {
+                return false;
+            }
+        } else if (strcmp(arg, "--control") == 0) {
+            options.workload.control = atof(value);
+        } else if (strcmp(arg, "--malformed") == 0) {
+            options.workload.malformed = atof(value);
+        } else if (strcmp(arg, "--speed") == 0) {
+            options.workload.speed_cps = atoi(value);
+        } else if (strcmp(arg, "--layout") == 0) {
+            options.workload.layout = value;
+        } else if (strcmp(arg, "--report") == 0) {
+            options.report_s = atof(value);
+        } else if (strcmp(arg, "--drain") == 0) {
+            options.drain_s = atof(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            options.seed = strtoull(value, NULL, 10);
+        } else {
+            return false;
+        }
+        i += takes_value ? 1 : 0;
+    }
+    return options.report_s > 0 && options.workload.control + options.workload.malformed <= 1.0;
+}
+
+double ms(uint64_t us) {
+    return us / 1000.0;
+}
+
+void printLatency(const char* label, const LatencyHistogram& latency) {
+    if (latency.count() == 0) {
+        printf(" | %s -", label);
+        return;
+    }
+    printf(" | %s p50 %.1f p99 %.1f max %.1f", label,
+           ms(latency.percentile(50)), ms(latency.percentile(99)), ms(latency.max()));
+}
+
+double percentOf(uint64_t part, uint64_t whole) {
+    return whole ? 100.0 * part / whole : 0.0;
+}
+
+// 구간 보고 한 줄 (지연 단위 ms)
+void printInterval(double elapsed_s, double interval_s, const TrafficCounters& c, size_t outstanding) {
+    printf("%7.0fs sent %" PRIu64 " (%.1f msg/s, %.1f KB/s) ok %" PRIu64 " rej %" PRIu64 " (%.1f%%) done %" PRIu64
+           " inflight %zu",
+           elapsed_s, c.sent, c.sent / interval_s, c.sent_bytes / interval_s / 1024.0,
+           c.accepted, c.rejected, percentOf(c.rejected, c.accepted + c.rejected), c.completed, outstanding);
+    printLatency("ack", c.latency[LATENCY_ACK]);
+    printLatency("ctl", c.latency[LATENCY_CONTROL]);
+    printLatency("done", c.latency[LATENCY_DONE]);
+    if (c.unexpected || c.lost) {
+        printf(" | unexpected %" PRIu64 " lost %" PRIu64, c.unexpected, c.lost);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+void printLatencySummary(const char* label, const LatencyHistogram& latency) {
+    printf("  %-5s n=%-9" PRIu64 " mean %8.2f  p50 %8.2f  p90 %8.2f  p99 %8.2f  p99.9 %8.2f  max %8.2f ms\n",
+           label, latency.count(), ms(latency.mean()), ms(latency.percentile(50)), ms(latency.percentile(90)),
+           ms(latency.percentile(99)), ms(latency.percentile(99.9)), ms(latency.max()));
+}
+
+void printSummary(double elapsed_s, const ReplyTracker& tracker, uint64_t reconnects) {
+    const TrafficCounters& t = tracker.total();
+    printf("\n== summary (%.0fs) ==\n", elapsed_s);
+    printf("  sent %" PRIu64 " msgs, %" PRIu64 " bytes (%.1f msg/s, %.1f KB/s)\n",
+           t.sent, t.sent_bytes, t.sent / elapsed_s, t.sent_bytes / elapsed_s / 1024.0);
+    printf("  by kind:");
+    for (int kind = 0; kind < MSG_KIND_COUNT; kind++) {
+        printf(" %s=%" PRIu64, Workload::kindName((MessageKind)kind), tracker.sentOfKind((MessageKind)kind));
+    }
+    printf("\n  accepted %" PRIu64 ", rejected %" PRIu64 " (%.2f%%), completed %" PRIu64 "\n",
+           t.accepted, t.rejected, percentOf(t.rejected, t.accepted + t.rejected), t.completed);
+    printf("  expected errors %" PRIu64 ", unexpected replies %" PRIu64 ", lost %" PRIu64 ", reconnects %" PRIu64 "\n",
+           t.expected_errors, t.unexpected, t.lost, reconnects);
+    printLatencySummary("ack", t.latency[LATENCY_ACK]);
+    printLatencySummary("ctl", t.latency[LATENCY_CONTROL]);
+    printLatencySummary("done", t.latency[LATENCY_DONE]);
+    printf("  replies:");
+    for (const auto& code : tracker.replyCodes()) {
+        printf(" %s=%" PRIu64, code.first.c_str(), code.second);
+    }
+    printf("\n");
+}
+
+// 읽을 응답이 있으면 모두 처리 / 보낼 데이터가 있으면 전송 (최대 wait_ms 대기)
+// @return false 연결 끊김
+bool service(DeviceLink& link, ReplyTracker& tracker, int wait_ms, std::string* status_reply) {
+    pollfd descriptor = { link.handle(), (short)(POLLIN | (link.hasPending() ? POLLOUT : 0)), 0 };
+    int ready = poll(&descriptor, 1, wait_ms);
+    if (ready < 0) {
+        return errno == EINTR;
+    }
+    if (ready == 0) {
+        return true;
+    }
+    if (descriptor.revents & (POLLERR | POLLNVAL)) {
+        return false;
+    }
+    if ((descriptor.revents & POLLOUT) && !link.flush()) {
+        return false;
+    }
+    if (descriptor.revents & (POLLIN | POLLHUP)) {
+        std::vector<std::string> replies;
+        bool alive = link.receive(replies);
+        uint64_t now = nowUs();
+        for (const std::string& reply : replies) {
+            tracker.reply(reply, now);
+            if (status_reply && reply.compare(0, 4, "STS:") == 0) {
+                *status_reply = reply;
+            }
+        }
+        return alive;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    std::unique_ptr<DeviceLink> link;
+    std::string target;
+    if (!options.cdc_device.empty()) {
+        link.reset(new CdcLink(options.cdc_device));
+        target = options.cdc_device;
+    } else {
+        link.reset(new SocketLink(options.socket_path));
+        target = options.socket_path;
+    }
+    if (!link->open()) {
+        fprintf(stderr, "%s: %s\n", target.c_str(), strerror(errno));
+        return 1;
+    }
+    printf("loadgen: %s %s, rate %.1f/s%s, burst %u every %.1fs, window %zu, seed %" PRIu64 "\n",
+           link->name(), target.c_str(), options.rate, options.poisson ? " (poisson)" : "",
+           options.burst, options.burst_every_s, options.window, options.seed);
+
+    Workload workload(options.workload, options.seed);
+    ReplyTracker tracker;
+    std::mt19937_64 arrivals(options.seed ^ 0x9E3779B97F4A7C15ull);
+
+    const uint64_t started = nowUs();
+    const uint64_t deadline = options.duration_s > 0 ? started + (uint64_t)(options.duration_s * 1e6) : UINT64_MAX;
+    const uint64_t report_us = (uint64_t)(options.report_s * 1e6);
+    const uint64_t burst_us = options.burst_every_s > 0 ? (uint64_t)(options.burst_every_s * 1e6) : 0;
+    uint64_t next_send = started;
+    uint64_t next_report = started + report_us;
+    uint64_t next_burst = burst_us ? started + burst_us : UINT64_MAX;
+    uint64_t last_report = started;
+    uint64_t reconnect_at = 0;
+    uint64_t reconnects = 0;
+    unsigned burst_left = 0;
+
+    while (!stopRequested && nowUs() < deadline) {
+        uint64_t now = nowUs();
+
+        if (!link->isOpen()) {
+            // 장시간 시험 중 장치 재시작/분리 - 1초마다 다시 연결
+            if (now >= reconnect_at) {
+                reconnect_at = now + RECONNECT_INTERVAL_US;
+                if (link->open()) {
+                    reconnects++;
+                    fprintf(stderr, "reconnected to %s\n", target.c_str());
+                }
+            }
+        } else {
+            if (now >= next_burst) {
+                burst_left += options.burst;
+                next_burst += burst_us;
+            }
+            bool window_open = options.window == 0 || tracker.outstandingJobs() < options.window;
+            bool due = burst_left > 0 || options.rate <= 0 || now >= next_send;
+            if (due && window_open && !link->hasPending()) {
+                Message message = workload.next();
+                link->queue(message.bytes);
+                tracker.sent(message.kind, message.bytes.size(), now);
+                if (burst_left > 0) {
+                    burst_left--;
+                } else if (options.rate > 0) {
+                    double gap = options.poisson ?
+                        std::exponential_distribution<double>(options.rate)(arrivals) : 1.0 / options.rate;
+                    // 밀린 만큼 몰아 보내지 않도록 너무 늦었으면 기준을 현재로
+                    next_send = std::max(next_send + (uint64_t)(gap * 1e6), now - (uint64_t)1e6);
+                }
+            }
+
+            uint64_t wake = std::min(std::min(next_send, next_report), std::min(next_burst, deadline));
+            int wait_ms = burst_left > 0 || options.rate <= 0 || wake <= now ? 0 :
+                          (int)std::min<uint64_t>((wake - now) / 1000, MAX_POLL_WAIT_MS);
+            if (!service(*link, tracker, wait_ms, NULL)) {
+                fprintf(stderr, "connection lost\n");
+                link->close();
+                tracker.disconnected();
+                reconnect_at = nowUs() + RECONNECT_INTERVAL_US;
+            }
+        }
+        if (!link->isOpen()) {
+            poll(NULL, 0, MAX_POLL_WAIT_MS);
+        }
+
+        now = nowUs();
+        if (now >= next_report) {
+            printInterval((now - started) / 1e6, (now - last_report) / 1e6, tracker.interval(), tracker.outstandingJobs());
+            tracker.rollInterval();
+            last_report = now;
+            next_report += report_us;
+        }
+    }
+
+    // 남은 응답 기다린 뒤 장치 쪽 통계(수신 경로별 거부 수 등)를 한 번 조회
+    std::string status;
+    if (link->isOpen()) {
+        uint64_t drain_end = nowUs() + (uint64_t)(options.drain_s * 1e6);
+        stopRequested = 0;
+        while (!stopRequested && tracker.waiting() && nowUs() < drain_end &&
+               service(*link, tracker, MAX_POLL_WAIT_MS, NULL)) {
+        }
+        Message query = { PROTOCOL_STATUS, MSG_STATUS };
+        link->queue(query.bytes);
+        tracker.sent(query.kind, query.bytes.size(), nowUs());
+        uint64_t status_end = nowUs() + STATUS_WAIT_US;
+        while (!stopRequested && status.empty() && nowUs() < status_end &&
+               service(*link, tracker, MAX_POLL_WAIT_MS, &status)) {
+        }
+    }
+    tracker.disconnected();  // 끝까지 응답이 없던 요청
+    uint64_t ended = nowUs();
+    printInterval((ended - started) / 1e6, (ended - last_report) / 1e6, tracker.interval(), 0);
+    tracker.rollInterval();
+    printSummary((ended - started) / 1e6, tracker, reconnects);
+    if (!status.empty()) {
+        printf("  device: %s\n", status.c_str());
+    }
+    link->close();
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file reply_tracker.cpp
+ * @brief 요청/응답 대응 및 집계 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "reply_tracker.h"
+#include <string.h>
+
+namespace {
+
+bool startsWith(const std::string& text, const char* prefix) {
+    return text.compare(0, strlen(prefix), prefix) == 0;
+}
+
+} // namespace
+
+void TrafficCounters::add(const TrafficCounters& other) {
+    sent += other.sent;
+    sent_bytes += other.sent_bytes;
+    accepted += other.accepted;
+    rejected += other.rejected;
+    completed += other.completed;
+    expected_errors += other.expected_errors;
+    unexpected += other.unexpected;
+    lost += other.lost;
+    replies += other.replies;
+    for (size_t i = 0; i < LATENCY_CLASS_COUNT; i++) {
+        latency[i].merge(other.latency[i]);
+    }
+}
+
+ReplyTracker::ReplyTracker() : kind_sent() {
+}
+
+void ReplyTracker::sent(MessageKind kind, size_t bytes, uint64_t now_us) {
+    current.sent++;
+    current.sent_bytes += bytes;
+    kind_sent[kind]++;
+
+    switch (kind) {
+        case MSG_JOB:
+        case MSG_BAD_QUEUED:   pending[PENDING_ACK].push_back(now_us); break;
+        case MSG_STATUS:       pending[PENDING_STATUS].push_back(now_us); break;
+        case MSG_CONFIG:       pending[PENDING_CONFIG].push_back(now_us); break;
+        case MSG_BAD_INTERNAL: pending[PENDING_INTERNAL].push_back(now_us); break;
+        case MSG_BAD_STREAM:   pending[PENDING_STREAM].push_back(now_us); break;
+        case MSG_BAD_MIRROR:   pending[PENDING_MIRROR].push_back(now_us); break;
+        default:               break;  // 응답 없음
+    }
+}
+
+bool ReplyTracker::pop(PendingQueue queue, uint64_t& sent_us) {
+    if (pending[queue].empty()) {
+        current.unexpected++;
+        return false;
+    }
+    sent_us = pending[queue].front();
+    pending[queue].pop_front();
+    return true;
+}
+
+std::string ReplyTracker::replyCode(const std::string& message) {
+    // OK:/ERR:는 뒤의 코드까지, 나머지(STS:, PRG: 등)는 접두사만
+    if (startsWith(message, "OK:") || startsWith(message, "ERR:")) {
+        size_t end = message.find_first_of(":;", message.find(':') + 1);
+        return message.substr(0, end);
+    }
+    return message.substr(0, message.find(':'));
+}
+
+void ReplyTracker::reply(const std::string& message, uint64_t now_us) {
+    current.replies++;
+    reply_codes[replyCode(message)]++;
+
+    uint64_t sent_us = 0;
+    if (message == "OK:Queued for typing") {
+        if (pop(PENDING_ACK, sent_us)) {
+            current.accepted++;
+            current.latency[LATENCY_ACK].record(now_us - sent_us);
+            pending[PENDING_DONE].push_back(sent_us);
+        }
+    } else if (message == "ERR:QUEUE_FULL") {
+        // 제어 레인이 가득 차도 같은 응답이지만 제어 명령 비율이 낮아 작업 거부로 봄
+        if (pop(PENDING_ACK, sent_us)) {
+            current.rejected++;
+            current.latency[LATENCY_ACK].record(now_us - sent_us);
+        }
+    } else if (message == "ERR:BUSY") {
+        current.rejected++;
+    } else if (message == "OK:Typing completed") {
+        if (pop(PENDING_DONE, sent_us)) {
+            current.completed++;
+            current.latency[LATENCY_DONE].record(now_us - sent_us);
+        }
+    } else if (startsWith(message, "STS:") || startsWith(message, "SPD:")) {
+        if (pop(message[0] == 'S' && message[1] == 'T' ? PENDING_STATUS : PENDING_CONFIG, sent_us)) {
+            current.latency[LATENCY_CONTROL].record(now_us - sent_us);
+        }
+    } else if (message == "ERR:INVALID_DATA" || message == "ERR:NO_STREAM" || message == "ERR:MIRROR_CLOSED") {
+        PendingQueue queue = message == "ERR:INVALID_DATA" ? PENDING_INTERNAL :
+                             message == "ERR:NO_STREAM" ? PENDING_STREAM : PENDING_MIRROR;
+        if (pop(queue, sent_us)) {
+            current.expected_errors++;
+        }
+    } else if (message == "ERR:SNIPPET_NOT_FOUND") {
+        current.expected_errors++;  // 정의되지 않은 바이너리 프레임 (완료 응답은 따로 옴)
+    } else if (!startsWith(message, "PRG:")) {
+        current.unexpected++;
+    }
+}
+
+void ReplyTracker::disconnected() {
+    for (size_t i = 0; i < PENDING_COUNT; i++) {
+        current.lost += pending[i].size();
+        pending[i].clear();
+    }
+}
+
+bool ReplyTracker::waiting() const {
+    for (size_t i = 0; i < PENDING_COUNT; i++) {
+        if (!pending[i].empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ReplyTracker::rollInterval() {
+    overall.add(current);
+    current.reset();
+}
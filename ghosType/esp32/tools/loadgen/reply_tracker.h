@@ -0,0 +1,121 @@
+/**
+ * @file reply_tracker.h
+ * @brief 보낸 요청과 장치 응답을 맞춰 처리량, 거부율, 지연을 집계
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 장치 응답에는 요청 번호가 없으므로 응답 접두사마다 대기열을 두고 가장 오래된 요청과 맞춥니다.
+ * 수신 처리는 한 번에 하나씩(ingestMutex)이고 타이핑 단계와 제어 레인도 받은 순서대로 처리하므로
+ * 같은 종류의 응답은 요청 순서대로 옵니다.
+ *
+ * 지연은 세 가지로 나눠 잽니다.
+ *   - ack:  작업 전송 → OK:Queued for typing / ERR:QUEUE_FULL (수신 경로와 레인 처리)
+ *   - ctl:  제어 명령 전송 → STS: / SPD: (타이핑 중에도 키 사이에 처리되는지)
+ *   - done: 작업 전송 → OK:Typing completed (대기 + 컴파일 + 타이핑 전체)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <deque>
+#include <map>
+#include <string>
+#include "latency_histogram.h"
+#include "workload.h"
+
+enum LatencyClass {
+    LATENCY_ACK = 0,
+    LATENCY_CONTROL,
+    LATENCY_DONE,
+    LATENCY_CLASS_COUNT
+};
+
+/**
+ * @brief 구간 또는 전체 집계
+ */
+struct TrafficCounters {
+    uint64_t sent = 0;            ///< 보낸 메시지 수
+    uint64_t sent_bytes = 0;
+    uint64_t accepted = 0;        ///< OK:Queued for typing
+    uint64_t rejected = 0;        ///< ERR:QUEUE_FULL, ERR:BUSY
+    uint64_t completed = 0;       ///< OK:Typing completed
+    uint64_t expected_errors = 0; ///< 잘못된 메시지에 대한 정해진 오류 응답
+    uint64_t unexpected = 0;      ///< 맞출 요청이 없거나 모르는 응답
+    uint64_t lost = 0;            ///< 연결이 끊겨 응답을 받지 못한 요청
+    uint64_t replies = 0;
+    LatencyHistogram latency[LATENCY_CLASS_COUNT];
+
+    void add(const TrafficCounters& other);
+    void reset() { *this = TrafficCounters(); }
+};
+
+/**
+ * @brief 요청/응답 대응 및 집계
+ */
+class ReplyTracker {
+public:
+    ReplyTracker();
+
+    /**
+     * @brief 메시지 전송 기록
+     */
+    void sent(MessageKind kind, size_t bytes, uint64_t now_us);
+
+    /**
+     * @brief 응답 하나 처리
+     */
+    void reply(const std::string& message, uint64_t now_us);
+
+    /**
+     * @brief 연결 끊김 - 응답을 기다리던 요청은 모두 잃은 것으로 기록
+     */
+    void disconnected();
+
+    /**
+     * @brief 아직 끝나지 않은 작업 수 (전송 후 완료 응답 전)
+     */
+    size_t outstandingJobs() const { return pending[PENDING_ACK].size() + pending[PENDING_DONE].size(); }
+
+    /**
+     * @brief 응답을 기다리는 요청이 하나라도 있는지
+     */
+    bool waiting() const;
+
+    /**
+     * @brief 현재 구간 집계를 전체 집계에 더하고 새 구간 시작
+     */
+    void rollInterval();
+
+    const TrafficCounters& interval() const { return current; }
+    const TrafficCounters& total() const { return overall; }
+    const std::map<std::string, uint64_t>& replyCodes() const { return reply_codes; }
+    uint64_t sentOfKind(MessageKind kind) const { return kind_sent[kind]; }
+
+private:
+    // 응답 종류별 대기열
+    enum PendingQueue {
+        PENDING_ACK = 0,    ///< 작업 → 큐 추가 응답
+        PENDING_DONE,       ///< 받아들인 작업 → 완료 응답
+        PENDING_STATUS,     ///< GHTYPE_STS → STS:
+        PENDING_CONFIG,     ///< GHTYPE_CFG → SPD:
+        PENDING_INTERNAL,   ///< 내부용 프레임 → ERR:INVALID_DATA
+        PENDING_STREAM,     ///< 고아 스트림 프레임 → ERR:NO_STREAM
+        PENDING_MIRROR,     ///< 세션 밖 미러 글자 → ERR:MIRROR_CLOSED
+        PENDING_COUNT
+    };
+
+    /**
+     * @brief 대기열에서 가장 오래된 요청을 꺼냄
+     * @param[out] sent_us 그 요청의 전송 시각
+     * @return false 기다리는 요청 없음 (예상하지 못한 응답)
+     */
+    bool pop(PendingQueue queue, uint64_t& sent_us);
+
+    static std::string replyCode(const std::string& message);
+
+    std::deque<uint64_t> pending[PENDING_COUNT];
+    TrafficCounters current;
+    TrafficCounters overall;
+    std::map<std::string, uint64_t> reply_codes;
+    uint64_t kind_sent[MSG_KIND_COUNT];
+};
@@ -0,0 +1,227 @@
+/**
+ * @file workload.cpp
+ * @brief 부하 생성기 메시지 작업량 구현
+ * @version 1.0
+ * @date 2026-10-18
+ */
+
+#include "workload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config.h"
+
+namespace {
+
+const char* const KOREAN_WORDS[] = {
+    "안녕하세요", "감사합니다", "키보드", "블루투스", "입력", "시험", "한글", "문장", "동글",
+    "속도", "괜찮아", "띄어쓰기", "넓은", "맑은", "읽기", "사랑해", "고마워", "하늘", "되돼",
+    "값", "없다", "앉아", "꽃잎", "까치", "빠르게", "쓰기", "짧은", "긴", "글자", "확인"
+};
+const char* const ENGLISH_WORDS[] = {
+    "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "keyboard", "Bluetooth",
+    "typing", "queue", "latency", "HID", "report", "dongle", "stream", "chunk", "JSON", "value",
+    "soak", "test", "Hello,", "World!", "a", "is", "of", "to", "and", "x86_64"
+};
+// 단어 사이 구분자 - 줄바꿈, 탭, 이스케이프가 필요한 문자 포함
+const char* const SEPARATORS[] = { " ", " ", " ", " ", " ", ", ", ". ", "\n", "\t", " \"", "\\" };
+
+template <typename T, size_t N>
+constexpr size_t countOf(T (&)[N]) { return N; }
+
+bool isContinuation(char c) {
+    return ((uint8_t)c & 0xC0) == 0x80;
+}
+
+size_t codePoints(const std::string& text) {
+    size_t count = 0;
+    for (char c : text) {
+        count += isContinuation(c) ? 0 : 1;
+    }
+    return count;
+}
+
+// UTF-8 문자열 끝에서 코드 포인트 하나 제거
+void popCodePoint(std::string& text) {
+    while (!text.empty() && isContinuation(text.back())) {
+        text.pop_back();
+    }
+    if (!text.empty()) {
+        text.pop_back();
+    }
+}
+
+std::string escapeJson(const std::string& text) {
+    std::string out;
+    out.reserve(text.size() + 16);
+    for (char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:   out += c; break;
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+bool SizeDistribution::parse(const char* spec) {
+    char name[16] = {};
+    double first = 0;
+    double second = 0;
+    int fields = sscanf(spec, "%15[a-z]:%lf:%lf", name, &first, &second);
+    if (fields >= 2 && strcmp(name, "fixed") == 0) {
+        kind = FIXED;
+        a = first;
+    } else if (fields == 3 && strcmp(name, "uniform") == 0 && first <= second) {
+        kind = UNIFORM;
+        a = first;
+        b = second;
+    } else if (fields >= 2 && strcmp(name, "exp") == 0) {
+        kind = EXPONENTIAL;
+        a = first;
+    } else {
+        return false;
+    }
+    return a >= 1;
+}
+
+size_t SizeDistribution::sample(std::mt19937_64& rng) const {
+    double value = a;
+    if (kind == UNIFORM) {
+        value = std::uniform_real_distribution<double>(a, b + 1)(rng);
+    } else if (kind == EXPONENTIAL) {
+        value = std::exponential_distribution<double>(1.0 / a)(rng);
+    }
+    return value < 1 ? 1 : (size_t)value;
+}
+
+Workload::Workload(const WorkloadOptions& options, uint64_t seed) : options(options), rng(seed) {
+}
+
+bool Workload::chance(double probability) {
+    return std::uniform_real_distribution<double>(0, 1)(rng) < probability;
+}
+
+Message Workload::next() {
+    double roll = std::uniform_real_distribution<double>(0, 1)(rng);
+    if (roll < options.malformed) {
+        return malformed();
+    }
+    if (roll < options.malformed + options.control) {
+        return control();
+    }
+    return job();
+}
+
+std::string Workload::text(size_t code_points, bool& has_korean) {
+    std::string out;
+    size_t count = 0;
+    has_korean = false;
+    while (count < code_points) {
+        if (count > 0) {
+            const char* separator = SEPARATORS[rng() % countOf(SEPARATORS)];
+            out += separator;
+            count += strlen(separator);
+        }
+        bool korean = chance(options.korean);
+        const char* word = korean ? KOREAN_WORDS[rng() % countOf(KOREAN_WORDS)]
+                                  : ENGLISH_WORDS[rng() % countOf(ENGLISH_WORDS)];
+        has_korean = has_korean || korean;
+        out += word;
+        count = codePoints(out);
+    }
+    while (count > code_points) {
+        popCodePoint(out);
+        count--;
+    }
+    return out;
+}
+
+Message Workload::job() {
+    bool has_korean = false;
+    std::string body = text(options.size.sample(rng), has_korean);
+    bool json = options.form == FORM_JSON || (options.form == FORM_MIXED && chance(0.5));
+
+    std::string head;
+    std::string tail;
+    if (json) {
+        head = "{";
+        if (options.speed_cps > 0) {
+            head += "\"speed_cps\":" + std::to_string(options.speed_cps) + ",";
+        }
+        if (!options.layout.empty()) {
+            head += "\"layout\":\"" + options.layout + "\",";
+        }
+        head += "\"text\":\"";
+        tail = "\"}";
+    } else {
+        head = has_korean ? "GHTYPE_KOR:" : "GHTYPE_ENG:";
+    }
+
+    // 장치의 최대 메시지 크기에 맞춰 뒤에서 자름
+    std::string encoded = json ? escapeJson(body) : body;
+    while (options.max_bytes > 0 && head.size() + encoded.size() + tail.size() > options.max_bytes) {
+        size_t over = head.size() + encoded.size() + tail.size() - options.max_bytes;
+        for (size_t i = 0; i < over && !body.empty(); i++) {
+            popCodePoint(body);
+        }
+        encoded = json ? escapeJson(body) : body;
+    }
+    return { head + encoded + tail, MSG_JOB };
+}
+
+Message Workload::control() {
+    if (options.speed_cps > 0 && chance(0.5)) {
+        return { std::string(PROTOCOL_CONFIG) + "{\"speed_cps\":" + std::to_string(options.speed_cps) + "}",
+                 MSG_CONFIG };
+    }
+    return { PROTOCOL_STATUS, MSG_STATUS };
+}
+
+Message Workload::malformed() {
+    const char marker = (char)FRAME_MARKER;
+    switch (rng() % 10) {
+        case 0:  // 닫히지 않은 JSON - 원문 그대로 타이핑됨
+            return { "{\"text\":\"unterminated", MSG_BAD_QUEUED };
+        case 1:  // 잘못된 UTF-8 (겹침 없는 연속 바이트, 잘린 3바이트 문자)
+            return { "{\"text\":\"bad \xC3\x28 \x80 \xED\x95\"}", MSG_BAD_QUEUED };
+        case 2:  // 타입이 틀린 필드
+            return { "{\"text\":12345,\"speed_cps\":\"fast\"}", MSG_BAD_QUEUED };
+        case 3:  // 종류 바이트가 없는 바이너리 프레임
+            return { std::string(1, marker), MSG_BAD_QUEUED };
+        case 4:  // 정의되지 않은 바이너리 프레임
+            return { std::string(1, marker) + "\x7E\x01\x02\x03", MSG_BAD_QUEUED };
+        case 5:  // 클라이언트가 보내면 안 되는 내부용 프레임
+            return { std::string(1, marker) + (char)(chance(0.5) ? FRAME_CHUNK_JOB : FRAME_STREAM_JOB) +
+                     std::string("\x01\x00\x00\x00xyz", 7),
+                     MSG_BAD_INTERNAL };
+        case 6:  // 시작 프레임 없는 스트림 연속 프레임
+            return { std::string(1, marker) + (char)FRAME_STREAM_CONTINUE + "orphan", MSG_BAD_STREAM };
+        case 7:  // 미러 세션 밖의 미러 글자
+            return { std::string(1, marker) + (char)FRAME_MIRROR_KEYS + "m", MSG_BAD_MIRROR };
+        case 8: {  // 최대 크기를 넘는 메시지 - 수신 경로에서 버림
+            size_t size = (options.max_bytes ? options.max_bytes : MAX_MESSAGE_BYTES) + 1 + rng() % 512;
+            return { "{\"text\":\"" + std::string(size, 'x') + "\"}", MSG_BAD_SILENT };
+        }
+        default:  // 깨진 설정 JSON - 아무 설정도 바뀌지 않음
+            return { std::string(PROTOCOL_CONFIG) + "{speed_cps:", MSG_BAD_SILENT };
+    }
+}
+
+const char* Workload::kindName(MessageKind kind) {
+    switch (kind) {
+        case MSG_JOB:          return "job";
+        case MSG_STATUS:       return "status";
+        case MSG_CONFIG:       return "config";
+        case MSG_BAD_QUEUED:   return "bad_queued";
+        case MSG_BAD_INTERNAL: return "bad_internal";
+        case MSG_BAD_STREAM:   return "bad_stream";
+        case MSG_BAD_MIRROR:   return "bad_mirror";
+        case MSG_BAD_SILENT:   return "bad_silent";
+        default:               return "unknown";
+    }
+}
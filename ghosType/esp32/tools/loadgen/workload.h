@@ -0,0 +1,105 @@
+/**
+ * @file workload.h
+ * @brief 부하 생성기 메시지 작업량 (크기 분포, 한영 혼합, 제어 명령, 잘못된 프레임)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * 메시지마다 종류를 하나 정해 장치 프로토콜 그대로의 바이트를 만듭니다.
+ * 종류마다 장치가 즉시 보내는 응답이 정해져 있으므로 부하 생성기는 응답 접두사로
+ * 어떤 요청의 응답인지 맞춰 지연을 잽니다 (수신 처리는 한 번에 하나씩이므로 순서 유지).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <random>
+#include <string>
+
+/**
+ * @brief 생성한 메시지의 종류 - 기대하는 응답이 종류마다 다름
+ */
+enum MessageKind {
+    MSG_JOB = 0,          ///< 타이핑 작업 → OK:Queued for typing (또는 ERR:QUEUE_FULL), 끝나면 OK:Typing completed
+    MSG_STATUS,           ///< GHTYPE_STS → 제어 레인 처리 시 STS:
+    MSG_CONFIG,           ///< GHTYPE_CFG:{"speed_cps":n} → 제어 레인 처리 시 SPD:
+    MSG_BAD_QUEUED,       ///< 잘못된 JSON/UTF-8/모르는 프레임 - 일반 텍스트로 큐에 들어감 (MSG_JOB과 같은 응답)
+    MSG_BAD_INTERNAL,     ///< 내부용 프레임 → ERR:INVALID_DATA
+    MSG_BAD_STREAM,       ///< 시작 없는 스트림 연속 프레임 → ERR:NO_STREAM
+    MSG_BAD_MIRROR,       ///< 미러 세션 밖의 미러 글자 → ERR:MIRROR_CLOSED
+    MSG_BAD_SILENT,       ///< 너무 긴 메시지, 깨진 설정 JSON - 응답 없음
+    MSG_KIND_COUNT
+};
+
+/**
+ * @brief 텍스트 길이(코드 포인트 수) 분포
+ */
+struct SizeDistribution {
+    enum Kind { FIXED, UNIFORM, EXPONENTIAL } kind = FIXED;
+    double a = 64;           ///< FIXED: 길이, UNIFORM: 최소, EXPONENTIAL: 평균
+    double b = 64;           ///< UNIFORM: 최대
+
+    /**
+     * @brief "fixed:N", "uniform:MIN:MAX", "exp:MEAN" 해석
+     * @return false 형식 오류
+     */
+    bool parse(const char* spec);
+
+    size_t sample(std::mt19937_64& rng) const;
+};
+
+/**
+ * @brief 메시지 형식
+ */
+enum MessageForm {
+    FORM_JSON = 0,        ///< {"text":...,"speed_cps":n}
+    FORM_PREFIX,          ///< GHTYPE_KOR: / GHTYPE_ENG: 접두사
+    FORM_MIXED            ///< 둘을 섞음
+};
+
+struct WorkloadOptions {
+    SizeDistribution size;
+    MessageForm form = FORM_JSON;
+    double korean = 0.5;      ///< 단어 중 한글 비율 (0~1)
+    double control = 0.05;    ///< 메시지 중 제어 명령 비율
+    double malformed = 0.05;  ///< 메시지 중 잘못된 메시지 비율
+    int speed_cps = 0;        ///< 0이 아니면 JSON 작업에 speed_cps 지정
+    std::string layout;       ///< 비어 있지 않으면 JSON 작업에 layout 지정
+    size_t max_bytes = 0;     ///< 정상 메시지의 최대 크기 (장치의 MAX_MESSAGE_BYTES)
+};
+
+/**
+ * @brief 생성한 메시지 하나
+ */
+struct Message {
+    std::string bytes;
+    MessageKind kind;
+};
+
+/**
+ * @brief 무작위 메시지 생성기 (같은 시드면 같은 순서)
+ */
+class Workload {
+public:
+    Workload(const WorkloadOptions& options, uint64_t seed);
+
+    Message next();
+
+    static const char* kindName(MessageKind kind);
+
+private:
+    Message job();
+    Message control();
+    Message malformed();
+
+    /**
+     * @brief 한영 단어를 섞어 code_points개 길이의 텍스트 생성
+     * @param[out] has_korean 한글이 들어갔는지
+     */
+    std::string text(size_t code_points, bool& has_korean);
+
+    bool chance(double probability);
+
+    WorkloadOptions options;
+    std::mt19937_64 rng;
+};